@@ -1,22 +1,99 @@
 #include "binary_matrix.h"
 
-BinaryMatrix::BinaryMatrix(uint16_t width, uint16_t height) : width(width), height(height) {
-    // buffer = new uint8_t[width * height / 8];
-    buffer = (uint8_t*) malloc(width * height / 8);
-    clear();
+Rect::Rect() : x(0), y(0), width(0), height(0) {}
+
+Rect::Rect(int x, int y, int width, int height) : x(x), y(y), width(width), height(height) {}
+
+bool Rect::isEmpty() const {
+    return width <= 0 || height <= 0;
+}
+
+Rect Rect::intersect(const Rect &other) const {
+    int minX = max(x, other.x);
+    int minY = max(y, other.y);
+    int maxX = min(x + width, other.x + other.width);
+    int maxY = min(y + height, other.y + other.height);
+    return Rect(minX, minY, max(maxX - minX, 0), max(maxY - minY, 0));
+}
+
+Rect Rect::unite(const Rect &other) const {
+    if (isEmpty()) return other;
+    if (other.isEmpty()) return *this;
+
+    int minX = min(x, other.x);
+    int minY = min(y, other.y);
+    int maxX = max(x + width, other.x + other.width);
+    int maxY = max(y + height, other.y + other.height);
+    return Rect(minX, minY, maxX - minX, maxY - minY);
+}
+
+uint32_t Rect::area() const {
+    return isEmpty() ? 0 : (uint32_t) width * height;
+}
+
+
+const int BinaryMatrix::TILE_ROWS;
+
+BinaryMatrix::BinaryMatrix(uint16_t width, uint16_t height, TilePool *pool) : width(width), height(height), stride((width + 7) / 8) {
+    if (pool != nullptr && pool->tileBytes() != tileBytes(width)) {
+        Serial.printf("Error: tile pool has tiles of %d bytes, matrix needs %d; using dense storage\n", pool->tileBytes(), tileBytes(width));
+        pool = nullptr;
+    }
+
+    if (pool == nullptr) {
+        // buffer = new uint8_t[width * height / 8];
+        buffer = (uint8_t*) malloc(stride * height);
+        clear();
+        return;
+    }
+
+    buffer = nullptr;
+    _pool = pool;
+    _tileCount = (height + TILE_ROWS - 1) / TILE_ROWS;
+    _tiles = (uint8_t**) calloc(_tileCount, sizeof(uint8_t*));
+    _tileFill = (uint8_t*) calloc(_tileCount, 1);
+
+    _uniformRows = (uint8_t*) malloc(stride * 3);
+    memset(_uniformRows, 0x00, stride);
+    memset(_uniformRows + stride, 0xFF, stride);
 }
 
 BinaryMatrix::~BinaryMatrix() {
     free(buffer);
+
+    for (int t = 0; t < _tileCount; t++) {
+        if (_tiles[t] != nullptr) _pool->release(_tiles[t]);
+    }
+    free(_tiles);
+    free(_tileFill);
+    free(_uniformRows);
+}
+
+uint16_t BinaryMatrix::tileBytes(uint16_t width) {
+    return (width + 7) / 8 * TILE_ROWS;
+}
+
+bool BinaryMatrix::isSparse() const {
+    return _tiles != nullptr;
 }
 
 void BinaryMatrix::setPixel(uint16_t x, uint16_t y, bool value) {
     if (x < 0 || x >= width || y < 0 || y >= height) {
         Serial.printf("Error: location not in screen. Location is (%d,%d), screen size is (%d,%d)\n", x, y, width, height);
+        return;
     };
 
-    uint8_t &b = buffer[loc(x, y)];
+    EINK_STAT(pixelWrites++);
+
     uint8_t offset = x % 8;
+
+    if (_tiles != nullptr) {
+        // Writing a uniform tile's own value leaves it uniform
+        const int tile = y / TILE_ROWS;
+        if (_tiles[tile] == nullptr && ((_tileFill[tile] >> (7 - offset)) & 1) == value) return;
+    }
+
+    uint8_t &b = _tiles != nullptr ? rowData(y)[x / 8] : buffer[loc(x, y)];
     uint8_t mask = ~(0x80 >> offset); // take all bits except the one containing the pixel
     b &= mask;
     b |= value << (7 - offset);
@@ -28,52 +105,376 @@ bool BinaryMatrix::getPixel(uint16_t x, uint16_t y) const {
         return 0;
     }
 
-    uint8_t b = buffer[loc(x, y)];
+    uint8_t b = _tiles != nullptr ? rowData(y)[x / 8] : buffer[loc(x, y)];
     uint8_t offset = x % 8;
     uint8_t mask = 0x80 >> offset; // take only the bit w/ the pixel value
     return (b & mask) > 0; // masked val > 0 => bit is active
 }
 
 void BinaryMatrix::setRect(uint16_t x, uint16_t y, uint16_t width, uint16_t height, bool value) {
-    if (x < 0 || x+width >= this->width || y < 0 || y+height >= this->height) {
-        Serial.printf("Error: rect not in bounds of screen. Rect is (%d,%d,%d,%d), screen size is (%d,%d)", x, y, width, height, this->width, this->height);
+    if (x < 0 || x+width > this->width || y < 0 || y+height > this->height) {
+        Serial.printf("Error: rect not in bounds of screen. Rect is (%d,%d,%d,%d), screen size is (%d,%d)\n", x, y, width, height, this->width, this->height);
         return;
     }
 
+    for (int ys = y; ys < y + height; ys++) { // in unit of dots
+        // Full-width rects turn the sparse tiles they cover into uniform tiles
+        const bool tileStart = ys % TILE_ROWS == 0;
+        const bool coversTile = ys + TILE_ROWS <= y + height || (ys + TILE_ROWS >= this->height && y + height == this->height);
+        if (_tiles != nullptr && x == 0 && width == this->width && tileStart && coversTile) {
+            setTileUniform(ys / TILE_ROWS, value ? 0xFF : 0x00);
+            ys += TILE_ROWS - 1;
+            continue;
+        }
+
+        fillSpan(ys, x, x + width, value);
+    }
+}
+
+void BinaryMatrix::fillSpan(uint16_t y, uint16_t x0, uint16_t x1, bool value, uint8_t pattern) {
+    if (x0 >= x1 || pattern == 0) return;
+
+    EINK_STAT(spanWrites++);
+
     const uint8_t word = value ? 0xFF : 0x00;
 
-    // To take into account partial first/last byte
-    const int startX = (x-1) / 8 + 1; // ceil(x/8)
-    const int endX = (x + width) / 8; // floor( (x+width)/8 )
+    uint8_t fill;
+    if (isRowUniform(y, fill) && fill == word) return;
 
-    for (int ys = y; ys < y + height; ys++) { // in unit of dots
+    uint8_t *row = rowData(y);
 
-        if (startX > endX) { // Fill is only within one byte
-            for (int i = x; i < x + width; i++) setPixel(i, y, value);
-            continue;
+    const int first = x0 / 8;
+    const int last = (x1 - 1) / 8;
+    uint8_t firstMask = 0xFF >> (x0 % 8);               // bits from x0 to the end of the byte
+    uint8_t lastMask = 0xFF << (7 - (x1 - 1) % 8);      // bits from the start of the byte to x1 - 1
+
+    if (first == last) { // Fill is only within one byte
+        firstMask &= lastMask & pattern;
+        row[first] = (row[first] & ~firstMask) | (word & firstMask);
+        return;
+    }
+
+    firstMask &= pattern;
+    lastMask &= pattern;
+
+    // Partial first and last byte, full bytes in between
+    row[first] = (row[first] & ~firstMask) | (word & firstMask);
+    if (pattern == 0xFF) {
+        memset(row + first + 1, word, last - first - 1);
+    } else {
+        // The pattern word lines up with every byte, so it is the mask of the full bytes
+        for (int i = first + 1; i < last; i++) {
+            row[i] = (row[i] & ~pattern) | (word & pattern);
         }
+    }
+    row[last] = (row[last] & ~lastMask) | (word & lastMask);
+}
 
-        // Fill partial first byte
-        for (int i = x; i < startX * 8; i++) { // unit of dots
-            setPixel(i, ys, value);
+void BinaryMatrix::clear() {
+    if (_tiles == nullptr) {
+        memset(buffer, 0, stride * height);
+        return;
+    }
+
+    for (int t = 0; t < _tileCount; t++) {
+        setTileUniform(t, 0x00);
+    }
+}
+
+void BinaryMatrix::scroll(Rect rect, int dx, int dy, bool fill) {
+    rect = rect.intersect(Rect(0, 0, width, height));
+    if (rect.isEmpty() || (dx == 0 && dy == 0)) return;
+
+    const int keptWidth = rect.width - abs(dx);
+    const int keptHeight = rect.height - abs(dy);
+    if (keptWidth <= 0 || keptHeight <= 0) {
+        setRect(rect.x, rect.y, rect.width, rect.height, fill);
+        return;
+    }
+
+    const int srcX = rect.x + max(-dx, 0);
+    const int dstX = rect.x + max(dx, 0);
+
+    // Moving down starts at the bottom, so every source row is read before it is overwritten.
+    // Only a row shifted onto itself needs a copy.
+    uint8_t *temp = dy == 0 ? (uint8_t*) malloc(stride) : nullptr;
+    const BinaryMatrix &source = *this;
+
+    for (int i = 0; i < keptHeight; i++) {
+        const int y = dy > 0 ? rect.y + rect.height - 1 - i : rect.y + i;
+
+        const uint8_t *srcRow = source.rowData(y - dy);
+        if (temp != nullptr) {
+            memcpy(temp, srcRow, stride);
+            srcRow = temp;
         }
 
-        // Fill center
-        for (int xs = startX; xs < endX; xs++) { // unit of bytes
-            buffer[ys * this->width /  8 + xs] = word;
+        blitRow(srcRow, stride, srcX, rowData(y), dstX, keptWidth, ROP_COPY);
+    }
+
+    free(temp);
+
+    // Uncovered rows across the whole rect, then the uncovered columns of the moved rows
+    const int stripY = dy > 0 ? rect.y : rect.y + keptHeight;
+    for (int y = stripY; y < stripY + abs(dy); y++) {
+        fillSpan(y, rect.x, rect.x + rect.width, fill);
+    }
+
+    const int stripX = dx > 0 ? rect.x : rect.x + keptWidth;
+    const int movedY = rect.y + max(dy, 0);
+    for (int y = movedY; y < movedY + keptHeight && dx != 0; y++) {
+        fillSpan(y, stripX, stripX + abs(dx), fill);
+    }
+}
+
+const uint8_t *BinaryMatrix::rowData(uint16_t y) const {
+    if (_tiles == nullptr) return buffer + (int) stride * y;
+
+    const int tile = y / TILE_ROWS;
+    if (_tiles[tile] == nullptr) {
+        return _uniformRows + (_tileFill[tile] ? stride : 0);
+    }
+    return _tiles[tile] + (y % TILE_ROWS) * stride;
+}
+
+uint8_t *BinaryMatrix::rowData(uint16_t y) {
+    if (_tiles == nullptr) return buffer + (int) stride * y;
+
+    const int tile = y / TILE_ROWS;
+    if (_tiles[tile] == nullptr && materialize(tile) == nullptr) {
+        return _uniformRows + 2 * stride; // out of memory, writes are lost
+    }
+    return _tiles[tile] + (y % TILE_ROWS) * stride;
+}
+
+bool BinaryMatrix::isRowUniform(uint16_t y, uint8_t &value) const {
+    if (_tiles == nullptr) return false;
+
+    const int tile = y / TILE_ROWS;
+    if (_tiles[tile] != nullptr) return false;
+
+    value = _tileFill[tile];
+    return true;
+}
+
+void BinaryMatrix::compact() {
+    if (_tiles == nullptr) return;
+
+    for (int t = 0; t < _tileCount; t++) {
+        const uint8_t *tile = _tiles[t];
+        if (tile == nullptr) continue;
+
+        const int bytes = min(TILE_ROWS, height - t * TILE_ROWS) * stride;
+        const uint8_t fill = tile[0];
+        if (fill != 0x00 && fill != 0xFF) continue;
+
+        int i = 1;
+        while (i < bytes && tile[i] == fill) i++;
+        if (i == bytes) setTileUniform(t, fill);
+    }
+}
+
+uint8_t *BinaryMatrix::materialize(int tile) {
+    uint8_t *block = _pool->allocate();
+    if (block == nullptr) return nullptr;
+
+    memset(block, _tileFill[tile], _pool->tileBytes());
+    _tiles[tile] = block;
+    return block;
+}
+
+void BinaryMatrix::setTileUniform(int tile, uint8_t fill) {
+    if (_tiles[tile] != nullptr) {
+        _pool->release(_tiles[tile]);
+        _tiles[tile] = nullptr;
+    }
+    _tileFill[tile] = fill;
+}
+
+inline int BinaryMatrix::loc(uint16_t x, uint16_t y) const {
+    return (int) stride * y + x / 8;
+}
+
+
+// Reads the 8 source bits starting at bit. The bits must be inside the row.
+static inline uint8_t fetchBits(const uint8_t *row, int bit) {
+    const int index = bit >> 3;
+    const int offset = bit & 7;
+    if (offset == 0) return row[index];
+    return (row[index] << offset) | (row[index + 1] >> (8 - offset));
+}
+
+// Like fetchBits, but bits outside of the row read as 0. Only needed for the first and last byte.
+static inline uint8_t fetchBitsChecked(const uint8_t *row, int stride, int bit) {
+    const int index = bit >> 3; // floors for negative bits
+    const int offset = bit & 7;
+    uint8_t hi = index >= 0 && index < stride ? row[index] : 0;
+    if (offset == 0) return hi;
+    uint8_t lo = index + 1 >= 0 && index + 1 < stride ? row[index + 1] : 0;
+    return (hi << offset) | (lo >> (8 - offset));
+}
+
+// 32 bits in row order (MSB first), whatever the byte order of the CPU
+static inline uint32_t loadWord(const uint8_t *p) {
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    value = __builtin_bswap32(value);
+#endif
+    return value;
+}
+
+static inline void storeWord(uint8_t *p, uint32_t value) {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    value = __builtin_bswap32(value);
+#endif
+    memcpy(p, &value, sizeof(value));
+}
+
+// Reads the 32 source bits starting at bit, like fetchBits. With an unaligned bit it reads one
+// byte past them, which fetchBits would read for the last of the 4 bytes as well.
+static inline uint32_t fetchWord(const uint8_t *row, int bit) {
+    const int index = bit >> 3;
+    const int offset = bit & 7;
+    if (offset == 0) return loadWord(row + index);
+    return (loadWord(row + index) << offset) | (row[index + 4] >> (8 - offset));
+}
+
+template<RasterOp op, class T>
+static inline T combine(T d, T s) {
+    switch (op) {
+        case ROP_COPY: return s;
+        case ROP_OR: return d | s;
+        case ROP_AND: return d & s;
+        case ROP_XOR: return d ^ s;
+        case ROP_AND_NOT: return d & ~s;
+    }
+    return d;
+}
+
+template<RasterOp op>
+static void blitRowOp(const uint8_t *src, int srcStride, int srcX, uint8_t *dst, int dstX, int width, const uint8_t *mask) {
+    const int first = dstX >> 3;
+    const int last = (dstX + width - 1) >> 3;
+
+    // Source bit that lines up with the first bit of each destination byte
+    int bit = srcX - (dstX & 7);
+
+    // First and last byte are partial, and may need source bits outside of the row
+    uint8_t edgeMask = 0xFF >> (dstX & 7);
+    if (first == last) edgeMask &= 0xFF << (7 - ((dstX + width - 1) & 7));
+
+    uint8_t m = edgeMask;
+    if (mask) m &= fetchBitsChecked(mask, srcStride, bit);
+    dst[first] = (dst[first] & ~m) | (combine<op>(dst[first], fetchBitsChecked(src, srcStride, bit)) & m);
+    if (first == last) return;
+    bit += 8;
+
+    int i = first + 1;
+    if (op == ROP_COPY && mask == nullptr && (bit & 7) == 0) {
+        // Same alignment, plain copy
+        memcpy(dst + i, src + (bit >> 3), last - i);
+        bit += (last - i) * 8;
+        i = last;
+    } else if (mask == nullptr) {
+        // 4 bytes at a time: one shift and merge per word instead of per byte
+        for (; i + 4 <= last; i += 4, bit += 32) {
+            storeWord(dst + i, combine<op>(loadWord(dst + i), fetchWord(src, bit)));
+        }
+        for (; i < last; i++, bit += 8) {
+            dst[i] = combine<op>(dst[i], fetchBits(src, bit));
+        }
+    } else {
+        for (; i + 4 <= last; i += 4, bit += 32) {
+            const uint32_t wm = fetchWord(mask, bit);
+            const uint32_t d = loadWord(dst + i);
+            storeWord(dst + i, (d & ~wm) | (combine<op>(d, fetchWord(src, bit)) & wm));
         }
+        for (; i < last; i++, bit += 8) {
+            m = fetchBits(mask, bit);
+            dst[i] = (dst[i] & ~m) | (combine<op>(dst[i], fetchBits(src, bit)) & m);
+        }
+    }
+
+    edgeMask = 0xFF << (7 - ((dstX + width - 1) & 7));
+    m = edgeMask;
+    if (mask) m &= fetchBitsChecked(mask, srcStride, bit);
+    dst[last] = (dst[last] & ~m) | (combine<op>(dst[last], fetchBitsChecked(src, srcStride, bit)) & m);
+}
+
+void blitRow(const uint8_t *srcRow, int srcStride, int srcX, uint8_t *dstRow, int dstX, int width,
+    RasterOp rop, const uint8_t *maskRow) {
+
+    if (width <= 0) return;
 
-        // Fill partial last byte
-        for (int i = endX * 8; i < x + width; i++) { // unit of dots
-            setPixel(i, ys, value);
+    switch (rop) {
+        case ROP_COPY:
+            blitRowOp<ROP_COPY>(srcRow, srcStride, srcX, dstRow, dstX, width, maskRow);
+            break;
+        case ROP_OR:
+            blitRowOp<ROP_OR>(srcRow, srcStride, srcX, dstRow, dstX, width, maskRow);
+            break;
+        case ROP_AND:
+            blitRowOp<ROP_AND>(srcRow, srcStride, srcX, dstRow, dstX, width, maskRow);
+            break;
+        case ROP_XOR:
+            blitRowOp<ROP_XOR>(srcRow, srcStride, srcX, dstRow, dstX, width, maskRow);
+            break;
+        case ROP_AND_NOT:
+            blitRowOp<ROP_AND_NOT>(srcRow, srcStride, srcX, dstRow, dstX, width, maskRow);
+            break;
+    }
+}
+
+// Clips srcRect and the destination position against both matrices. Returns false if nothing is left.
+static bool clipBlit(const BinaryMatrix &src, Rect &srcRect, const BinaryMatrix &dst, int &x, int &y) {
+    const int dx = x - srcRect.x;
+    const int dy = y - srcRect.y;
+
+    Rect clipped = srcRect.intersect(Rect(0, 0, src.width, src.height));
+    clipped = clipped.intersect(Rect(-dx, -dy, dst.width, dst.height));
+    if (clipped.isEmpty()) return false;
+
+    srcRect = clipped;
+    x = clipped.x + dx;
+    y = clipped.y + dy;
+    return true;
+}
+
+static void blitRows(const BinaryMatrix &src, const BinaryMatrix *mask, Rect srcRect, BinaryMatrix &dst, int x, int y, RasterOp rop) {
+    if (!clipBlit(src, srcRect, dst, x, y)) return;
+
+    // Blitting within the same matrix: go against the direction of movement and read every
+    // source row before it is overwritten
+    const bool same = &src == &dst;
+    const bool upwards = same && y > srcRect.y;
+    uint8_t *temp = same ? (uint8_t*) malloc(src.stride) : nullptr;
+
+    for (int i = 0; i < srcRect.height; i++) {
+        const int row = upwards ? srcRect.height - 1 - i : i;
+
+        const uint8_t *srcRow = src.rowData(srcRect.y + row);
+        if (same) {
+            memcpy(temp, srcRow, src.stride);
+            srcRow = temp;
         }
+        const uint8_t *maskRow = mask ? mask->rowData(srcRect.y + row) : nullptr;
+
+        blitRow(srcRow, src.stride, srcRect.x, dst.rowData(y + row), x, srcRect.width, rop, maskRow);
     }
+
+    free(temp);
 }
 
-void BinaryMatrix::clear() {
-    memset(buffer, 0, width * height / 8);
+void blit(const BinaryMatrix &src, Rect srcRect, BinaryMatrix &dst, int x, int y, RasterOp rop) {
+    blitRows(src, nullptr, srcRect, dst, x, y, rop);
 }
 
-inline int BinaryMatrix::loc(uint16_t x, uint16_t y) const {
-    return (int) width * y / 8 + x / 8;;
+void blitMasked(const BinaryMatrix &src, const BinaryMatrix &mask, Rect srcRect, BinaryMatrix &dst, int x, int y) {
+    if (mask.width != src.width || mask.height != src.height) {
+        Serial.printf("Error: mask size (%d,%d) does not match source size (%d,%d)\n", mask.width, mask.height, src.width, src.height);
+        return;
+    }
+
+    blitRows(src, &mask, srcRect, dst, x, y, ROP_COPY);
 }
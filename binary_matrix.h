@@ -3,23 +3,123 @@
 
 #include <Arduino.h>
 
+#include "render_stats.h"
+#include "tile_pool.h"
+
+struct Rect {
+    int x;
+    int y;
+    int width;
+    int height;
+
+    Rect();
+    Rect(int x, int y, int width, int height);
+
+    bool isEmpty() const;
+    Rect intersect(const Rect &other) const;
+
+    // Smallest rect containing both; an empty rect contributes nothing
+    Rect unite(const Rect &other) const;
+    uint32_t area() const;
+};
+
+/**
+ * How source pixels are combined with destination pixels by blit()
+ */
+enum RasterOp : uint8_t {
+    ROP_COPY,       // dst = src
+    ROP_OR,         // dst = dst | src
+    ROP_AND,        // dst = dst & src
+    ROP_XOR,        // dst = dst ^ src
+    ROP_AND_NOT,    // dst = dst & ~src
+};
+
+/**
+ * 1 bit per pixel surface of any size. Rows start on a byte boundary and hold 8 pixels per byte,
+ * leftmost pixel in the MSB.
+ *
+ * Storage is either dense (one buffer) or sparse. A sparse matrix is split into tiles of
+ * TILE_ROWS full rows, taken from a TilePool only when something other than the tile's uniform
+ * value is written. Tiles span the full width so every row stays contiguous in memory.
+ */
 struct BinaryMatrix {
-    uint8_t *buffer;
+    static const int TILE_ROWS = 8;
+
+    uint8_t *buffer; // dense storage, nullptr when sparse
     const uint16_t width;
     const uint16_t height;
+    const uint16_t stride; // bytes per row
+
+#if EINK_STATS
+    uint32_t pixelWrites = 0;
+    uint32_t spanWrites = 0;
+#endif
 
-    BinaryMatrix(uint16_t width, uint16_t height);
+    // Sparse storage is used when a pool with tiles of tileBytes(width) is given, dense otherwise
+    BinaryMatrix(uint16_t width, uint16_t height, TilePool *pool = nullptr);
     ~BinaryMatrix();
 
+    static uint16_t tileBytes(uint16_t width);
+    bool isSparse() const;
+
     void setPixel(uint16_t x, uint16_t y, bool value);
     bool getPixel(uint16_t x, uint16_t y) const;
 
     void setRect(uint16_t x, uint16_t y, uint16_t width, uint16_t height, bool value);
 
+    // Sets pixels [x0, x1) of row y, a byte at a time. Only the pixels whose bit is set in pattern
+    // (leftmost pixel of each byte in the MSB) are written.
+    void fillSpan(uint16_t y, uint16_t x0, uint16_t x1, bool value, uint8_t pattern = 0xFF);
+
     void clear();
 
+    // Moves the pixels inside rect by (dx, dy). Pixels moved out of rect are dropped and the
+    // strips left uncovered are set to fill.
+    void scroll(Rect rect, int dx, int dy, bool fill);
+
+    // Bytes of row y, 8 pixels per byte with the leftmost pixel in the MSB. Getting a writable
+    // row of a sparse matrix allocates its tile.
+    const uint8_t *rowData(uint16_t y) const;
+    uint8_t *rowData(uint16_t y);
+
+    // True if all bytes of row y are known to be value without reading them
+    bool isRowUniform(uint16_t y, uint8_t &value) const;
+
+    // Returns tiles that became uniform to the pool
+    void compact();
+
 private:
+    TilePool *_pool = nullptr;
+    uint8_t **_tiles = nullptr;     // nullptr for uniform tiles
+    uint8_t *_tileFill = nullptr;   // byte value of uniform tiles
+    uint8_t *_uniformRows = nullptr; // a row of 0x00, a row of 0xFF and a scratch row
+    int _tileCount = 0;
+
     inline int loc(uint16_t x, uint16_t y) const;
+
+    uint8_t *materialize(int tile);
+    void setTileUniform(int tile, uint8_t fill);
 };
 
+/**
+ * Copies srcRect of src to (x, y) of dst, combining pixels with rop. Source and destination
+ * may be at any bit alignment, and may be the same matrix. The rect is clipped to both.
+ */
+void blit(const BinaryMatrix &src, Rect srcRect, BinaryMatrix &dst, int x, int y, RasterOp rop = ROP_COPY);
+
+/**
+ * Like blit() with ROP_COPY, but only where mask (same size as src) is set; the other
+ * destination pixels are left as they are.
+ */
+void blitMasked(const BinaryMatrix &src, const BinaryMatrix &mask, Rect srcRect, BinaryMatrix &dst, int x, int y);
+
+/**
+ * Combines width bits of a source row starting at bit srcX into a destination row starting at
+ * bit dstX (srcX >= 0). Whole destination bytes are produced 32 bits at a time from a shift
+ * and merge of the source words, the partial first and last byte from two source bytes.
+ * If maskRow is set, only bits set in it (aligned like the source) are written.
+ */
+void blitRow(const uint8_t *srcRow, int srcStride, int srcX, uint8_t *dstRow, int dstX, int width,
+    RasterOp rop, const uint8_t *maskRow = nullptr);
+
 #endif
@@ -0,0 +1,115 @@
+#include "box_font.h"
+
+static void putWord(uint8_t *&p, uint16_t value) {
+    *p++ = value & 0xFF;
+    *p++ = value >> 8;
+}
+
+static void putDword(uint8_t *&p, uint32_t value) {
+    putWord(p, value & 0xFFFF);
+    putWord(p, value >> 16);
+}
+
+static void putBlock(uint8_t *&p, uint8_t type, uint32_t size) {
+    *p++ = type;
+    putDword(p, size);
+}
+
+static const int BOX_FIRST_CHAR = 32;
+static const int BOX_CHAR_COUNT = 95;
+static const int BOX_COLUMNS = 16;
+static const int BOX_KERNING_PAIRS = 26;
+
+BoxFont makeBoxFont(int glyphWidth, int glyphHeight) {
+    BoxFont font;
+    font.glyphWidth = glyphWidth;
+    font.glyphHeight = glyphHeight;
+
+    const int rows = (BOX_CHAR_COUNT + BOX_COLUMNS - 1) / BOX_COLUMNS;
+    const int sheetWidth = BOX_COLUMNS * glyphWidth;
+    const int sheetHeight = rows * glyphHeight;
+
+    // RGB565 sheet: white background, ink where blue <= 1
+    font.pixels = (uint8_t*) malloc(sheetWidth * sheetHeight * 2);
+    for (int y = 0; y < sheetHeight; y++) {
+        for (int x = 0; x < sheetWidth; x++) {
+            int gx = x % glyphWidth;
+            int gy = y % glyphHeight;
+            bool ink = gx == 1 || gy == 1 || gx == glyphWidth - 2 || gy == glyphHeight - 2
+                || gx * glyphHeight == gy * glyphWidth;
+            uint16_t color = ink ? 0x0000 : 0xFFFF;
+            font.pixels[(y * sheetWidth + x) * 2 + 0] = color & 0xFF;
+            font.pixels[(y * sheetWidth + x) * 2 + 1] = color >> 8;
+        }
+    }
+    font.image = new Image(sheetWidth, sheetHeight, 2, font.pixels);
+
+    const char pageName[] = "box.png";
+    const int size = 4 + (5 + 15) + (5 + 15) + (5 + sizeof(pageName))
+        + (5 + BOX_CHAR_COUNT * 20) + (5 + BOX_KERNING_PAIRS * 10);
+    font.descriptor = (uint8_t*) malloc(size);
+
+    uint8_t *p = font.descriptor;
+    *p++ = 'B';
+    *p++ = 'M';
+    *p++ = 'F';
+    *p++ = 3;
+
+    // Block 1: info
+    putBlock(p, 1, 15);
+    putWord(p, glyphHeight);   // fontSize
+    *p++ = 0;                       // bitField
+    *p++ = 0;                       // charSet
+    putWord(p, 100);           // stretchH
+    *p++ = 1;                       // aa
+    for (int i = 0; i < 7; i++) *p++ = 0;  // padding, spacing, outline
+    *p++ = 0;                       // fontName
+
+    // Block 2: common
+    putBlock(p, 2, 15);
+    putWord(p, glyphHeight);   // lineHeight
+    putWord(p, glyphHeight - 2);   // base
+    putWord(p, sheetWidth);
+    putWord(p, sheetHeight);
+    putWord(p, 1);             // pages
+    for (int i = 0; i < 5; i++) *p++ = 0;
+
+    // Block 3: pages
+    putBlock(p, 3, sizeof(pageName));
+    memcpy(p, pageName, sizeof(pageName));
+    p += sizeof(pageName);
+
+    // Block 4: chars
+    putBlock(p, 4, BOX_CHAR_COUNT * 20);
+    for (int c = 0; c < BOX_CHAR_COUNT; c++) {
+        putDword(p, BOX_FIRST_CHAR + c);
+        putWord(p, (c % BOX_COLUMNS) * glyphWidth);
+        putWord(p, (c / BOX_COLUMNS) * glyphHeight);
+        putWord(p, glyphWidth);
+        putWord(p, glyphHeight);
+        putWord(p, 0);             // xoffset
+        putWord(p, 0);             // yoffset
+        putWord(p, glyphWidth + 1);    // xadvance
+        *p++ = 0;                       // page
+        *p++ = 15;                      // chnl
+    }
+
+    // Block 5: kerning, "AV", "BW", ...
+    putBlock(p, 5, BOX_KERNING_PAIRS * 10);
+    for (int k = 0; k < BOX_KERNING_PAIRS; k++) {
+        putDword(p, 'A' + k);
+        putDword(p, 'A' + (k + 21) % 26);
+        putWord(p, (uint16_t) -1);
+    }
+
+    return font;
+}
+
+void freeBoxFont(BoxFont &font) {
+    delete font.image;
+    free(font.pixels);
+    free(font.descriptor);
+    font.image = nullptr;
+    font.pixels = nullptr;
+    font.descriptor = nullptr;
+}
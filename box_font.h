@@ -0,0 +1,27 @@
+#ifndef box_font_h
+#define box_font_h
+
+#include <Arduino.h>
+
+#include "font.h"
+
+/**
+ * Font built in RAM, so examples, benchmarks and tests do not depend on font assets: a BMFont
+ * binary descriptor and an RGB565 glyph sheet. Glyphs 32-126 are laid out on a 16 column grid
+ * and drawn as a box with a diagonal, which gives drawText a realistic mix of set and unset
+ * pixels. The pairs "AV", "BW", ... are kerned by -1.
+ */
+struct BoxFont {
+    uint8_t *descriptor;
+    uint8_t *pixels;
+    Image *image;
+
+    int glyphWidth;
+    int glyphHeight;
+};
+
+// Pass image and descriptor to Font; they must outlive it. Free them with freeBoxFont().
+BoxFont makeBoxFont(int glyphWidth, int glyphHeight);
+void freeBoxFont(BoxFont &font);
+
+#endif
@@ -0,0 +1,59 @@
+#include "byte_stream.h"
+
+MemorySink::MemorySink(uint8_t *buffer, uint32_t capacity) : _buffer(buffer), _capacity(capacity) {}
+
+bool MemorySink::write(const uint8_t *data, uint32_t length) {
+    if (length > _capacity - _size) return false;
+
+    memcpy(_buffer + _size, data, length);
+    _size += length;
+    return true;
+}
+
+uint32_t MemorySink::size() const {
+    return _size;
+}
+
+MemorySource::MemorySource(const uint8_t *data, uint32_t size) : _data(data), _size(size) {}
+
+bool MemorySource::read(uint8_t *data, uint32_t length) {
+    if (length > _size - _position) return false;
+
+    memcpy(data, _data + _position, length);
+    _position += length;
+    return true;
+}
+
+
+StreamSink::StreamSink(Stream &stream) : _stream(stream) {}
+
+bool StreamSink::write(const uint8_t *data, uint32_t length) {
+    return _stream.write(data, length) == length;
+}
+
+StreamSource::StreamSource(Stream &stream) : _stream(stream) {}
+
+bool StreamSource::read(uint8_t *data, uint32_t length) {
+    return _stream.readBytes(data, length) == length;
+}
+
+
+FileSink::FileSink(FILE *file) : _file(file) {}
+
+bool FileSink::write(const uint8_t *data, uint32_t length) {
+    return fwrite(data, 1, length, _file) == length;
+}
+
+FileSource::FileSource(FILE *file) : _file(file) {}
+
+bool FileSource::read(uint8_t *data, uint32_t length) {
+    return fread(data, 1, length, _file) == length;
+}
+
+
+CountingSource::CountingSource(ByteSource &source) : _source(source) {}
+
+bool CountingSource::read(uint8_t *data, uint32_t length) {
+    count += length;
+    return _source.read(data, length);
+}
@@ -0,0 +1,100 @@
+#ifndef byte_stream_h
+#define byte_stream_h
+
+#include <Arduino.h>
+#include <stdio.h>
+
+/**
+ * Destination of serialized data (snapshots). write() returns false when the data could not be
+ * stored completely.
+ */
+class ByteSink {
+public:
+    virtual ~ByteSink() {}
+    virtual bool write(const uint8_t *data, uint32_t length) = 0;
+};
+
+/**
+ * Origin of serialized data. read() returns false when fewer than length bytes are left.
+ */
+class ByteSource {
+public:
+    virtual ~ByteSource() {}
+    virtual bool read(uint8_t *data, uint32_t length) = 0;
+};
+
+// Fixed buffer, e.g. RTC memory that survives deep sleep
+class MemorySink : public ByteSink {
+    uint8_t *_buffer;
+    uint32_t _capacity;
+    uint32_t _size = 0;
+
+public:
+    MemorySink(uint8_t *buffer, uint32_t capacity);
+
+    bool write(const uint8_t *data, uint32_t length) override;
+    uint32_t size() const;
+};
+
+class MemorySource : public ByteSource {
+    const uint8_t *_data;
+    uint32_t _size;
+    uint32_t _position = 0;
+
+public:
+    MemorySource(const uint8_t *data, uint32_t size);
+
+    bool read(uint8_t *data, uint32_t length) override;
+};
+
+// Arduino streams, e.g. a File of LittleFS or SPIFFS
+class StreamSink : public ByteSink {
+    Stream &_stream;
+
+public:
+    StreamSink(Stream &stream);
+
+    bool write(const uint8_t *data, uint32_t length) override;
+};
+
+class StreamSource : public ByteSource {
+    Stream &_stream;
+
+public:
+    StreamSource(Stream &stream);
+
+    bool read(uint8_t *data, uint32_t length) override;
+};
+
+// stdio files, for the host and for ESP-IDF VFS paths
+class FileSink : public ByteSink {
+    FILE *_file;
+
+public:
+    FileSink(FILE *file);
+
+    bool write(const uint8_t *data, uint32_t length) override;
+};
+
+class FileSource : public ByteSource {
+    FILE *_file;
+
+public:
+    FileSource(FILE *file);
+
+    bool read(uint8_t *data, uint32_t length) override;
+};
+
+// Counts the bytes read through it, e.g. for statistics
+class CountingSource : public ByteSource {
+    ByteSource &_source;
+
+public:
+    uint32_t count = 0;
+
+    CountingSource(ByteSource &source);
+
+    bool read(uint8_t *data, uint32_t length) override;
+};
+
+#endif
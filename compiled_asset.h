@@ -0,0 +1,48 @@
+#ifndef compiled_asset_h
+#define compiled_asset_h
+
+#include <Arduino.h>
+
+/**
+ * Layout of the headers generated by tools/asset_compiler.py. Everything is plain data so the
+ * generated tables are constexpr and stay in flash; nothing is parsed or converted at runtime.
+ */
+
+// 1 bit per pixel, 1 = ink. Rows start on a byte boundary, leftmost pixel in the MSB (the
+// BinaryMatrix layout).
+struct CompiledBitmap {
+    uint16_t width;
+    uint16_t height;
+    const uint8_t *bits;
+};
+
+// Position of the glyph in the font's sheet and its metrics, as in the BMFont descriptor
+struct CompiledGlyph {
+    uint32_t id;
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+    int16_t xoffset;
+    int16_t yoffset;
+    int16_t xadvance;
+};
+
+struct CompiledKerning {
+    uint32_t first;
+    uint32_t second;
+    int16_t amount;
+};
+
+struct CompiledFont {
+    uint16_t lineHeight;
+    uint16_t base;
+    CompiledBitmap sheet;
+
+    const CompiledGlyph *glyphs;        // sorted by id
+    uint16_t glyphCount;
+    const CompiledKerning *kerning;     // sorted by (first, second)
+    uint16_t kerningCount;
+};
+
+#endif
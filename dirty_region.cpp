@@ -0,0 +1,77 @@
+#include "dirty_region.h"
+
+const int DirtyRegion::MAX_RECTS;
+
+// Also true for rects that only share an edge, merging them costs nothing
+static bool touches(const Rect &a, const Rect &b) {
+    return a.x <= b.x + b.width && b.x <= a.x + a.width && a.y <= b.y + b.height && b.y <= a.y + a.height;
+}
+
+void DirtyRegion::add(Rect rect) {
+    if (rect.isEmpty()) return;
+
+    // A merged rect may now touch others, so merging repeats until it stands alone
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (int i = 0; i < _count; i++) {
+            if (touches(_rects[i], rect)) {
+                rect = rect.unite(_rects[i]);
+                _rects[i] = _rects[--_count];
+                merged = true;
+                break;
+            }
+        }
+    }
+
+    if (_count < MAX_RECTS) {
+        _rects[_count++] = rect;
+        return;
+    }
+
+    int best = 0;
+    uint32_t bestGrowth = UINT32_MAX;
+    for (int i = 0; i < _count; i++) {
+        const uint32_t growth = _rects[i].unite(rect).area() - _rects[i].area();
+        if (growth < bestGrowth) {
+            best = i;
+            bestGrowth = growth;
+        }
+    }
+
+    Rect united = _rects[best].unite(rect);
+    _rects[best] = _rects[--_count];
+    add(united);
+}
+
+void DirtyRegion::clear() {
+    _count = 0;
+}
+
+bool DirtyRegion::isEmpty() const {
+    return _count == 0;
+}
+
+int DirtyRegion::count() const {
+    return _count;
+}
+
+const Rect &DirtyRegion::operator[](int index) const {
+    return _rects[index];
+}
+
+Rect DirtyRegion::bounds() const {
+    Rect result;
+    for (int i = 0; i < _count; i++) {
+        result = result.unite(_rects[i]);
+    }
+    return result;
+}
+
+uint32_t DirtyRegion::area() const {
+    uint32_t total = 0;
+    for (int i = 0; i < _count; i++) {
+        total += _rects[i].area();
+    }
+    return total;
+}
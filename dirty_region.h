@@ -0,0 +1,33 @@
+#ifndef dirty_region_h
+#define dirty_region_h
+
+#include <Arduino.h>
+
+#include "binary_matrix.h"
+
+/**
+ * Areas of the frame changed since the last transfer, as a short list of disjoint rects. Rects
+ * that touch are merged. When the list is full, the new rect is merged into the rect whose area
+ * grows least, so the list never covers much more than what changed.
+ */
+class DirtyRegion {
+public:
+    static const int MAX_RECTS = 8;
+
+private:
+    Rect _rects[MAX_RECTS];
+    int _count = 0;
+
+public:
+    void add(Rect rect);
+    void clear();
+
+    bool isEmpty() const;
+    int count() const;
+    const Rect &operator[](int index) const;
+
+    Rect bounds() const;
+    uint32_t area() const;
+};
+
+#endif
@@ -0,0 +1,51 @@
+#include "display_group.h"
+
+void DisplayGroup::add(Renderer *panel) {
+    _panels.push_back(panel);
+}
+
+int DisplayGroup::size() const {
+    return _panels.size();
+}
+
+Renderer &DisplayGroup::operator[](int index) {
+    return *_panels[index];
+}
+
+bool DisplayGroup::poll() {
+    bool working = false;
+
+    for (Renderer *panel : _panels) {
+        if (panel->isBusy()) {
+            working = true;
+            continue;
+        }
+
+        if (panel->isDirty()) {
+            if (!_updating) {
+                _updating = true;
+                _updateStart = micros();
+            }
+
+            // Blocks for the transfer only, the refresh runs while the other panels are served
+            panel->renderAsync();
+            working = true;
+        }
+    }
+
+    if (!working && _updating) {
+        _updating = false;
+        _lastUpdateMicros = micros() - _updateStart;
+    }
+    return working;
+}
+
+void DisplayGroup::update() {
+    while (poll()) {
+        delay(1);
+    }
+}
+
+uint32_t DisplayGroup::lastUpdateMicros() const {
+    return _lastUpdateMicros;
+}
@@ -0,0 +1,43 @@
+#ifndef display_group_h
+#define display_group_h
+
+#include <Arduino.h>
+#include <vector>
+
+#include "renderer.h"
+
+/**
+ * Several panels sharing one SPI bus, each with its own CS, DC, BUSY and RESET pins (see
+ * Renderer(const EInkConfig&)). The bus can only serve one panel at a time, but a refresh takes
+ * far longer than a transfer and does not need the bus: while one panel refreshes, the next
+ * frame is sent to another. Updating N panels then takes about the N transfers plus the longest
+ * refresh, instead of the sum of all refreshes.
+ *
+ * Every panel keeps its own frame, dirty region and stats.
+ */
+class DisplayGroup {
+    std::vector<Renderer*> _panels;
+
+    uint32_t _updateStart = 0;
+    uint32_t _lastUpdateMicros = 0;
+    bool _updating = false;
+
+public:
+    // Panels are not owned
+    void add(Renderer *panel);
+
+    int size() const;
+    Renderer &operator[](int index);
+
+    // Sends frames to idle panels that changed and starts their refresh. Returns true while a
+    // panel is still refreshing or waiting for the bus; call it again until it returns false.
+    bool poll();
+
+    // Updates every panel that changed and returns when all refreshes are done
+    void update();
+
+    // Time from the first transfer to the end of the last refresh of the last update
+    uint32_t lastUpdateMicros() const;
+};
+
+#endif
@@ -0,0 +1,318 @@
+#include "display_transport.h"
+
+#if defined(ESP32)
+#include <driver/gpio.h>
+#include <esp_heap_caps.h>
+#include <soc/gpio_reg.h>
+#endif
+
+// Started once, however many displays share it. Every command and data burst is its own
+// transaction, as beginTransaction() locks the bus until endTransaction().
+static bool arduinoSpiStarted = false;
+
+static void beginArduinoSpi() {
+    if (!arduinoSpiStarted) {
+        SPI.begin();
+        arduinoSpiStarted = true;
+    }
+}
+
+
+// ArduinoSpiTransport
+
+void ArduinoSpiTransport::begin(const EInkConfig &config) {
+    _cs = config.cs;
+    _dc = config.dc;
+    _busy = config.busy;
+    _reset = config.reset;
+
+    pinMode(_cs, OUTPUT);
+    pinMode(_dc, OUTPUT);
+    pinMode(_busy, INPUT);
+    pinMode(_reset, OUTPUT);
+    digitalWrite(_cs, HIGH);
+
+    beginArduinoSpi();
+}
+
+void ArduinoSpiTransport::writeCommand(uint8_t command) {
+    SPI.beginTransaction(EINK_SPI_SETTINGS);
+    digitalWrite(_dc, LOW);
+    digitalWrite(_cs, LOW);
+    SPI.transfer(command);
+    digitalWrite(_cs, HIGH);
+    SPI.endTransaction();
+}
+
+void ArduinoSpiTransport::beginData() {
+    SPI.beginTransaction(EINK_SPI_SETTINGS);
+    digitalWrite(_dc, HIGH);
+    digitalWrite(_cs, LOW);
+}
+
+void ArduinoSpiTransport::writeData(const uint8_t *data, uint32_t length) {
+#if defined(ESP32)
+    SPI.writeBytes(data, length);
+#else
+    for (uint32_t i = 0; i < length; i++) {
+        SPI.transfer(data[i]);
+    }
+#endif
+}
+
+void ArduinoSpiTransport::writeRepeat(uint8_t value, uint32_t count) {
+#if defined(ESP32)
+    SPI.writePattern(&value, 1, count);
+#else
+    for (uint32_t i = 0; i < count; i++) {
+        SPI.transfer(value);
+    }
+#endif
+}
+
+void ArduinoSpiTransport::endData() {
+    digitalWrite(_cs, HIGH);
+    SPI.endTransaction();
+}
+
+bool ArduinoSpiTransport::isBusy() {
+    return digitalRead(_busy);
+}
+
+void ArduinoSpiTransport::setReset(bool high) {
+    digitalWrite(_reset, high ? HIGH : LOW);
+}
+
+void ArduinoSpiTransport::delayMs(uint32_t ms) {
+    delay(ms);
+}
+
+
+// FastGpioTransport
+
+void FastGpioTransport::begin(const EInkConfig &config) {
+    _busy = config.busy;
+    _reset = config.reset;
+
+    pinMode(config.cs, OUTPUT);
+    pinMode(config.dc, OUTPUT);
+    pinMode(_busy, INPUT);
+    pinMode(_reset, OUTPUT);
+
+    _csMask = digitalPinToBitMask(config.cs);
+    _dcMask = digitalPinToBitMask(config.dc);
+
+#if defined(ESP32)
+    _csSet = (volatile uint32_t*) (config.cs < 32 ? GPIO_OUT_W1TS_REG : GPIO_OUT1_W1TS_REG);
+    _csClear = (volatile uint32_t*) (config.cs < 32 ? GPIO_OUT_W1TC_REG : GPIO_OUT1_W1TC_REG);
+    _dcSet = (volatile uint32_t*) (config.dc < 32 ? GPIO_OUT_W1TS_REG : GPIO_OUT1_W1TS_REG);
+    _dcClear = (volatile uint32_t*) (config.dc < 32 ? GPIO_OUT_W1TC_REG : GPIO_OUT1_W1TC_REG);
+#else
+    _csPort = portOutputRegister(digitalPinToPort(config.cs));
+    _dcPort = portOutputRegister(digitalPinToPort(config.dc));
+#endif
+
+    csHigh();
+
+    beginArduinoSpi();
+}
+
+void FastGpioTransport::writeData(const uint8_t *data, uint32_t length) {
+#if defined(ESP32)
+    SPI.writeBytes(data, length);
+#else
+    for (uint32_t i = 0; i < length; i++) {
+        SPI.transfer(data[i]);
+    }
+#endif
+}
+
+void FastGpioTransport::writeRepeat(uint8_t value, uint32_t count) {
+#if defined(ESP32)
+    SPI.writePattern(&value, 1, count);
+#else
+    for (uint32_t i = 0; i < count; i++) {
+        SPI.transfer(value);
+    }
+#endif
+}
+
+bool FastGpioTransport::isBusy() {
+    return digitalRead(_busy);
+}
+
+void FastGpioTransport::setReset(bool high) {
+    digitalWrite(_reset, high ? HIGH : LOW);
+}
+
+void FastGpioTransport::delayMs(uint32_t ms) {
+    delay(ms);
+}
+
+
+// Esp32DmaTransport
+
+#if defined(ESP32)
+
+// DC pin and level are packed into the transaction's user field: (pin << 1) | level
+static void IRAM_ATTR esp32SetDcBeforeTransfer(spi_transaction_t *transaction) {
+    const int user = (int) transaction->user;
+    gpio_set_level((gpio_num_t) (user >> 1), user & 1);
+}
+
+static bool esp32BusInitialized = false;
+
+void Esp32DmaTransport::begin(const EInkConfig &config) {
+    _dc = config.dc;
+    _busy = config.busy;
+    _reset = config.reset;
+
+    pinMode(_dc, OUTPUT);
+    pinMode(_busy, INPUT);
+    pinMode(_reset, OUTPUT);
+
+    // Several displays may share the bus, each with its own CS
+    if (!esp32BusInitialized) {
+        spi_bus_config_t bus = {};
+        bus.mosi_io_num = EINK_SPI_MOSI;
+        bus.miso_io_num = -1;
+        bus.sclk_io_num = EINK_SPI_SCK;
+        bus.quadwp_io_num = -1;
+        bus.quadhd_io_num = -1;
+        bus.max_transfer_sz = CHUNK_SIZE;
+
+#ifdef SPI_DMA_CH_AUTO
+        esp_err_t err = spi_bus_initialize(EINK_SPI_HOST, &bus, SPI_DMA_CH_AUTO);
+#else
+        esp_err_t err = spi_bus_initialize(EINK_SPI_HOST, &bus, 1);
+#endif
+        if (err != ESP_OK) {
+            Serial.printf("Error: could not initialize SPI bus (%d)\n", err);
+            return;
+        }
+        esp32BusInitialized = true;
+    }
+
+    spi_device_interface_config_t device = {};
+    device.clock_speed_hz = 2000000;
+    device.mode = 0;
+    device.spics_io_num = config.cs;
+    device.queue_size = QUEUE_SIZE;
+    device.pre_cb = esp32SetDcBeforeTransfer;
+
+    esp_err_t err = spi_bus_add_device(EINK_SPI_HOST, &device, &_device);
+    if (err != ESP_OK) {
+        Serial.printf("Error: could not add SPI device (%d)\n", err);
+        return;
+    }
+
+    for (int i = 0; i < QUEUE_SIZE; i++) {
+        _slots[i].buffer = (uint8_t*) heap_caps_malloc(CHUNK_SIZE, MALLOC_CAP_DMA);
+    }
+}
+
+void Esp32DmaTransport::writeCommand(uint8_t command) {
+    Slot &slot = acquire();
+    slot.buffer[0] = command;
+    submit(slot, 1, false);
+}
+
+void Esp32DmaTransport::beginData() {
+    _fill = -1;
+}
+
+void Esp32DmaTransport::writeData(const uint8_t *data, uint32_t length) {
+    while (length > 0) {
+        if (_fill < 0) {
+            acquire();
+            _fill = 0;
+        }
+
+        Slot &slot = _slots[_next];
+        uint32_t n = min(length, (uint32_t) (CHUNK_SIZE - _fill));
+        memcpy(slot.buffer + _fill, data, n);
+        _fill += n;
+        data += n;
+        length -= n;
+
+        if (_fill == CHUNK_SIZE) {
+            submit(slot, _fill, true);
+            _fill = -1;
+        }
+    }
+}
+
+void Esp32DmaTransport::writeRepeat(uint8_t value, uint32_t count) {
+    while (count > 0) {
+        if (_fill < 0) {
+            acquire();
+            _fill = 0;
+        }
+
+        Slot &slot = _slots[_next];
+        uint32_t n = min(count, (uint32_t) (CHUNK_SIZE - _fill));
+        memset(slot.buffer + _fill, value, n);
+        _fill += n;
+        count -= n;
+
+        if (_fill == CHUNK_SIZE) {
+            submit(slot, _fill, true);
+            _fill = -1;
+        }
+    }
+}
+
+void Esp32DmaTransport::endData() {
+    if (_fill > 0) {
+        submit(_slots[_next], _fill, true);
+    }
+    _fill = -1;
+}
+
+bool Esp32DmaTransport::isBusy() {
+    flush(); // the command that starts a refresh must be out before BUSY means anything
+    return digitalRead(_busy);
+}
+
+void Esp32DmaTransport::setReset(bool high) {
+    flush();
+    digitalWrite(_reset, high ? HIGH : LOW);
+}
+
+void Esp32DmaTransport::delayMs(uint32_t ms) {
+    flush();
+    delay(ms);
+}
+
+Esp32DmaTransport::Slot &Esp32DmaTransport::acquire() {
+    // Transactions complete in order, so when the ring is full the next slot is the oldest one
+    if (_inFlight == QUEUE_SIZE) {
+        spi_transaction_t *done;
+        spi_device_get_trans_result(_device, &done, portMAX_DELAY);
+        _inFlight--;
+    }
+    return _slots[_next];
+}
+
+void Esp32DmaTransport::submit(Slot &slot, uint32_t length, bool data) {
+    spi_transaction_t &t = slot.transaction;
+    memset(&t, 0, sizeof(t));
+    t.length = length * 8; // in bits
+    t.tx_buffer = slot.buffer;
+    t.user = (void*) ((_dc << 1) | (data ? 1 : 0));
+
+    spi_device_queue_trans(_device, &t, portMAX_DELAY);
+    _inFlight++;
+    _next = (_next + 1) % QUEUE_SIZE;
+}
+
+void Esp32DmaTransport::flush() {
+    while (_inFlight > 0) {
+        spi_transaction_t *done;
+        spi_device_get_trans_result(_device, &done, portMAX_DELAY);
+        _inFlight--;
+    }
+}
+
+#endif
+
@@ -0,0 +1,178 @@
+#ifndef display_transport_h
+#define display_transport_h
+
+#include <SPI.h>
+#include <Arduino.h>
+
+#include "host_transport.h"
+#include "panel_profile.h"
+
+#if defined(ESP32)
+#include <driver/spi_master.h>
+#endif
+
+/*
+ * Transports move bytes between EInkDisplay and the controller. They are used as a template
+ * parameter of BasicEInkDisplay, so every call is resolved at compile time. A transport provides:
+ *
+ *   void begin(const EInkConfig &config);
+ *   void writeCommand(uint8_t command);
+ *   void beginData();                                      // following writes are data bytes
+ *   void writeData(const uint8_t *data, uint32_t length);
+ *   void writeRepeat(uint8_t value, uint32_t count);
+ *   void endData();
+ *   bool isBusy();
+ *   void setReset(bool high);
+ *   void delayMs(uint32_t ms);
+ */
+
+// Data writes are MSB first (D7 -> D0, D0 LSB)
+#define EINK_SPI_SETTINGS SPISettings(2000000, MSBFIRST, SPI_MODE0)
+
+/**
+ * Global Arduino SPI object, with digitalWrite on DC/CS.
+ */
+class ArduinoSpiTransport {
+    int _cs;
+    int _dc;
+    int _busy;
+    int _reset;
+
+public:
+    void begin(const EInkConfig &config);
+
+    void writeCommand(uint8_t command);
+    void beginData();
+    void writeData(const uint8_t *data, uint32_t length);
+    void writeRepeat(uint8_t value, uint32_t count);
+    void endData();
+
+    bool isBusy();
+    void setReset(bool high);
+    void delayMs(uint32_t ms);
+};
+
+/**
+ * Global Arduino SPI object, with DC/CS toggled through the GPIO output registers.
+ */
+class FastGpioTransport {
+#if defined(ESP32)
+    // Write-1-to-set/clear registers, no read-modify-write needed
+    volatile uint32_t *_csSet;
+    volatile uint32_t *_csClear;
+    volatile uint32_t *_dcSet;
+    volatile uint32_t *_dcClear;
+#else
+    // Output registers are 8 bit on AVR and 32 bit on most other cores
+    typedef decltype(portOutputRegister(0)) PortRegister;
+    PortRegister _csPort;
+    PortRegister _dcPort;
+#endif
+    uint32_t _csMask;
+    uint32_t _dcMask;
+
+    int _busy;
+    int _reset;
+
+public:
+    void begin(const EInkConfig &config);
+
+    inline void writeCommand(uint8_t command) {
+        SPI.beginTransaction(EINK_SPI_SETTINGS);
+        dcLow();
+        csLow();
+        SPI.transfer(command);
+        csHigh();
+        SPI.endTransaction();
+    }
+
+    inline void beginData() {
+        SPI.beginTransaction(EINK_SPI_SETTINGS);
+        dcHigh();
+        csLow();
+    }
+
+    void writeData(const uint8_t *data, uint32_t length);
+    void writeRepeat(uint8_t value, uint32_t count);
+
+    inline void endData() {
+        csHigh();
+        SPI.endTransaction();
+    }
+
+    bool isBusy();
+    void setReset(bool high);
+    void delayMs(uint32_t ms);
+
+private:
+#if defined(ESP32)
+    inline void csLow() { *_csClear = _csMask; }
+    inline void csHigh() { *_csSet = _csMask; }
+    inline void dcLow() { *_dcClear = _dcMask; }
+    inline void dcHigh() { *_dcSet = _dcMask; }
+#else
+    inline void csLow() { *_csPort &= ~_csMask; }
+    inline void csHigh() { *_csPort |= _csMask; }
+    inline void dcLow() { *_dcPort &= ~_dcMask; }
+    inline void dcHigh() { *_dcPort |= _dcMask; }
+#endif
+};
+
+#if defined(ESP32)
+
+#ifndef EINK_SPI_HOST
+#define EINK_SPI_HOST SPI3_HOST
+#endif
+#ifndef EINK_SPI_SCK
+#define EINK_SPI_SCK 18
+#endif
+#ifndef EINK_SPI_MOSI
+#define EINK_SPI_MOSI 23
+#endif
+
+/**
+ * ESP-IDF SPI master with DMA. Data is copied into a ring of DMA buffers and queued, so the
+ * caller prepares the next chunk while the previous one is being clocked out. CS is driven by
+ * the SPI peripheral and DC is set from the pre-transfer callback.
+ */
+class Esp32DmaTransport {
+    static const int QUEUE_SIZE = 4;
+    static const int CHUNK_SIZE = 1024;
+
+    struct Slot {
+        spi_transaction_t transaction;
+        uint8_t *buffer;
+    };
+
+    spi_device_handle_t _device = nullptr;
+    Slot _slots[QUEUE_SIZE];
+    int _next = 0;          // next slot to fill
+    int _inFlight = 0;      // queued transactions not yet reclaimed
+    int _fill = -1;         // bytes in the slot being filled, -1 if none
+
+    int _dc;
+    int _busy;
+    int _reset;
+
+public:
+    void begin(const EInkConfig &config);
+
+    void writeCommand(uint8_t command);
+    void beginData();
+    void writeData(const uint8_t *data, uint32_t length);
+    void writeRepeat(uint8_t value, uint32_t count);
+    void endData();
+
+    bool isBusy();
+    void setReset(bool high);
+    void delayMs(uint32_t ms);
+
+private:
+    Slot &acquire();
+    void submit(Slot &slot, uint32_t length, bool data);
+    void flush();
+};
+
+#endif
+
+#endif
@@ -0,0 +1,50 @@
+#include "draw_queue.h"
+
+static DrawCommand makeCommand(DrawOp op, int a0 = 0, int a1 = 0, int a2 = 0, int a3 = 0, int a4 = 0, int a5 = 0) {
+    DrawCommand command;
+    command.op = op;
+    command.args[0] = a0;
+    command.args[1] = a1;
+    command.args[2] = a2;
+    command.args[3] = a3;
+    command.args[4] = a4;
+    command.args[5] = a5;
+    return command;
+}
+
+DrawCommand DrawCommand::drawRect(int x, int y, int width, int height) {
+    return makeCommand(DRAW_RECT, x, y, width, height);
+}
+
+DrawCommand DrawCommand::fillRect(int x, int y, int width, int height) {
+    return makeCommand(DRAW_FILL_RECT, x, y, width, height);
+}
+
+DrawCommand DrawCommand::fillRoundRect(int x, int y, int width, int height, int radius) {
+    return makeCommand(DRAW_ROUND_RECT, x, y, width, height, radius);
+}
+
+DrawCommand DrawCommand::fillCircle(int centerX, int centerY, int radius) {
+    return makeCommand(DRAW_CIRCLE, centerX, centerY, radius);
+}
+
+DrawCommand DrawCommand::drawLine(int x1, int y1, int x2, int y2) {
+    return makeCommand(DRAW_LINE, x1, y1, x2, y2);
+}
+
+DrawCommand DrawCommand::fillTriangle(int x0, int y0, int x1, int y1, int x2, int y2) {
+    return makeCommand(DRAW_TRIANGLE, x0, y0, x1, y1, x2, y2);
+}
+
+DrawCommand DrawCommand::drawText(int x, int y, const char *text, Font *font, TextAlignment align) {
+    DrawCommand command = makeCommand(DRAW_TEXT, x, y);
+    strncpy(command.text, text, MAX_TEXT - 1);
+    command.text[MAX_TEXT - 1] = 0;
+    command.font = font;
+    command.align = align;
+    return command;
+}
+
+DrawCommand DrawCommand::invalidate(Rect rect) {
+    return makeCommand(DRAW_INVALIDATE, rect.x, rect.y, rect.width, rect.height);
+}
@@ -0,0 +1,58 @@
+#ifndef draw_queue_h
+#define draw_queue_h
+
+#include <Arduino.h>
+
+#include "mpsc_queue.h"
+#include "renderer.h"
+
+enum DrawOp : uint8_t {
+    DRAW_RECT,          // x, y, width, height
+    DRAW_FILL_RECT,     // x, y, width, height
+    DRAW_ROUND_RECT,    // x, y, width, height, radius
+    DRAW_CIRCLE,        // centerX, centerY, radius
+    DRAW_LINE,          // x1, y1, x2, y2
+    DRAW_TRIANGLE,      // x0, y0, x1, y1, x2, y2
+    DRAW_TEXT,          // x, y and text, with font and align
+    DRAW_INVALIDATE,    // x, y, width, height
+};
+
+/**
+ * A draw call with all the renderer state it depends on, so commands from different tasks can't
+ * affect each other. The text is copied into the command.
+ */
+struct DrawCommand {
+    static const int MAX_TEXT = 48;
+
+    DrawOp op = DRAW_RECT;
+    DisplayColor color = DisplayColor::BLACK;
+    bool clear = false;         // clear mode instead of draw mode
+    TextAlignment align = TextAlignment::LEFT;
+    Rect clip;                  // empty for the whole screen
+    Font *font = nullptr;
+    FillPattern pattern;
+    int16_t args[6] = { 0 };
+    char text[MAX_TEXT] = { 0 };
+
+    static DrawCommand drawRect(int x, int y, int width, int height);
+    static DrawCommand fillRect(int x, int y, int width, int height);
+    static DrawCommand fillRoundRect(int x, int y, int width, int height, int radius);
+    static DrawCommand fillCircle(int centerX, int centerY, int radius);
+    static DrawCommand drawLine(int x1, int y1, int x2, int y2);
+    static DrawCommand fillTriangle(int x0, int y0, int x1, int y1, int x2, int y2);
+    // Text longer than MAX_TEXT - 1 characters is cut
+    static DrawCommand drawText(int x, int y, const char *text, Font *font, TextAlignment align = TextAlignment::LEFT);
+    static DrawCommand invalidate(Rect rect);
+};
+
+/**
+ * Commands from any number of tasks for the task that owns the Renderer, which executes them with
+ * Renderer::drain(). Producers never wait for drawing or SPI; push() returns false when the
+ * queue is full.
+ */
+class DrawQueue : public MpscQueue<DrawCommand> {
+public:
+    DrawQueue(uint32_t capacity) : MpscQueue<DrawCommand>(capacity) {}
+};
+
+#endif
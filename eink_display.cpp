@@ -5,233 +5,402 @@
 
 #include "eink_display.h"
 
-EInkDisplay::Config::Config(int width, int height) : width(width), height(height) {}
+#include <pgmspace.h>
 
-EInkDisplay::Config::Config(int width, int height, int cs, int dc, int busy, int reset) : width(width), height(height), cs(cs), dc(dc), busy(busy), reset(reset) {}
-
-EInkDisplay::EInkDisplay(EInkDisplay::Config config) : _config(config) {
+template<class Transport>
+BasicEInkDisplay<Transport>::BasicEInkDisplay(Config config) : _config(config) {
 }
 
-void EInkDisplay::setup() {
-    pinMode(_config.cs, OUTPUT);
-    pinMode(_config.dc, OUTPUT);
-    pinMode(_config.busy, INPUT);
-    pinMode(_config.reset, OUTPUT);
+template<class Transport>
+BasicEInkDisplay<Transport>::~BasicEInkDisplay() {
+    free(_rowBuffer);
+}
 
-    // Data writes are MSB first (D7 -> D0, D0 LSB)
-    SPISettings settings = SPISettings(2000000, MSBFIRST, SPI_MODE0);
-    SPI.begin();
-    SPI.beginTransaction(settings);
+template<class Transport>
+void BasicEInkDisplay<Transport>::setup() {
+    _transport.begin(_config);
 
     //reset();
     initialize();
 }
 
 
-void EInkDisplay::writeBuffer(uint8_t* buffer, bool black) {
-    writeCommand(0x4E); // Reset RAM y-address to 0
-    writeData(0x00);
-    writeData(0x00);
+template<class Transport>
+void BasicEInkDisplay<Transport>::writeBuffer(const BinaryMatrix &frame, bool black) {
+    writePartial(frame, 0, 0, frame.width, frame.height, black);
+}
 
-    writeCommand(0x4F); // Reset RAM y-address to 0
-    writeData(0x00);
-    writeData(0x00);
+template<class Transport>
+void BasicEInkDisplay<Transport>::apply() {
+    waitIdle();
+    runScript(_config.panel->refreshScript);
+}
 
-    // Determine which RAM to write
-    if (black) {
-        writeCommand(0x24);
-    } else {
-        writeCommand(0x26);
+template<class Transport>
+void BasicEInkDisplay<Transport>::applyAsync() {
+    waitIdle();
+
+    const int offset = runScript(_config.panel->refreshScript, 0, true);
+    if (offset >= 0) {
+        _pendingScript = _config.panel->refreshScript;
+        _pendingOffset = offset;
+        _pendingSince = millis();
+        _settling = false;
+        EINK_STAT(_busyStart = micros());
     }
+}
 
-    for (uint32_t y = 0; y < _config.height; y++) { // in bits
-
-        // A byte has data of 8 pixels
-        for (uint32_t x = 0; x < _config.width / 8; x++) { // in bytes
-            uint8_t data = buffer[(_config.width * y) / 8 + x];
+template<class Transport>
+bool BasicEInkDisplay<Transport>::isBusy() {
+    if (_pendingScript == nullptr) return false;
 
-            if (black) {
-                writeData(~data);
-            } else {
-                writeData(data);
-            }
-        }
+    // The same timing as waitNotBusy()
+    const uint32_t now = millis();
+    if (!_settling) {
+        if (now - _pendingSince < BUSY_RISE_MS || _transport.isBusy()) return true;
+        _settling = true;
+        _pendingSince = now;
     }
-
+    if (now - _pendingSince < BUSY_SETTLE_MS) return true;
+    _settling = false;
+
+#if EINK_STATS
+    const uint32_t elapsed = micros() - _busyStart;
+    _stats.busyMicros += elapsed;
+    emitTrace(_trace, TRACE_BUSY, 0, elapsed);
+#endif
+
+    // The rest of the script may wait again
+    const uint8_t *script = _pendingScript;
+    _pendingScript = nullptr;
+    const int offset = runScript(script, _pendingOffset, true);
+    if (offset >= 0) {
+        _pendingScript = script;
+        _pendingOffset = offset;
+        _pendingSince = millis();
+        EINK_STAT(_busyStart = micros());
+        return true;
+    }
+    return false;
 }
 
-void EInkDisplay::apply() {
-    // Apply
-    writeCommand(0x22); // display update control 2
-    writeData(0xC7);
+template<class Transport>
+void BasicEInkDisplay<Transport>::waitIdle() {
+    while (isBusy()) {
+        _transport.delayMs(10);
+    }
+}
 
-    writeCommand(0x20); // master activation
+template<class Transport>
+void BasicEInkDisplay<Transport>::writePartial(const BinaryMatrix &frame, int bufX, int bufY, int bufWidth, int bufHeight, bool black) {
+    const PanelProfile &panel = *_config.panel;
+    waitIdle();
 
-    waitNotBusy();
-}
+    // Find the area to update on the panel, within the screen
+    _orientation.toPanelRect(frame.width, frame.height, bufX, bufY, bufWidth, bufHeight);
 
-void EInkDisplay::writePartial(unsigned char* buffer, int bufX, int bufY, int bufWidth, int bufHeight, bool black) {
+    const int minX = constrain(bufX, 0, _config.width);
+    const int minY = constrain(bufY, 0, _config.height);
+    const int maxX = constrain(bufX + bufWidth, 0, _config.width);
+    const int maxY = constrain(bufY + bufHeight, 0, _config.height);
+    if (minX >= maxX || minY >= maxY) return;
 
     // the address is in bits, but we're sending bytes of data at a time. we need to round down to nearest byte
     // to properly send data
-    const int lowerByteX = bufX >> 3; // round down to nearest byte
-    const int upperByteX = (bufX + bufWidth + 8 - 1) >> 3; // basically ceil((bufX+bufWidth) / 8)
+    const int lowerByteX = minX >> 3; // round down to nearest byte
+    const int upperByteX = (maxX + 8 - 1) >> 3; // basically ceil(maxX / 8)
 
     const int lowerBitX = lowerByteX << 3; // multiply by 8 for address offset (addr offset in bits)
 
+    const bool invert = black && panel.invertBlack;
+    const bool fullWidth = lowerByteX == 0 && upperByteX == _config.width / 8;
 
-    for (uint32_t y = bufY; y < bufY + bufHeight; y++) { // in bits
+    PanelRowReader reader(frame, _orientation);
+    uint8_t *row = nullptr;
+    if (!_orientation.isIdentity()) {
+        if (_rowBuffer == nullptr) _rowBuffer = (uint8_t*) malloc((_config.width + 7) / 8);
+        if (_rowBuffer == nullptr) {
+            Serial.println("Error: not enough memory to rotate the frame");
+            return;
+        }
+        row = _rowBuffer;
+    }
 
-        writeCommand(0x4E); // Set RAM x-addr to start of min x
-        writeData(lowerBitX & 0xFF);
-        writeData((lowerBitX >> 8) & 0x03);
+    EINK_STAT(beginTransfer(black ? STAT_PLANE_BLACK : STAT_PLANE_RED));
 
-        writeCommand(0x4F); // Set RAM y-addr to start of min y
-        writeData(y & 0xFF);
-        writeData((y >> 8) & 0x03);
+    for (int y = minY; y < maxY; y++) { // in bits
+        // Full rows continue where the previous one ended, so the address is only needed once
+        if (y == minY || !fullWidth) {
+            setRamAddress(lowerBitX, y);
 
-        // Determine which RAM to write
-        if (black) {
-            writeCommand(0x24);
-        } else {
-            writeCommand(0x26);
+            // Determine which RAM to write
+            writeCommand(black ? panel.cmdWriteBlack : panel.cmdWriteRed);
+            _transport.beginData();
         }
 
         // A byte has data of 8 pixels
-        for (uint32_t x = lowerByteX; x < upperByteX; x++) { // in bytes
-            uint8_t data = buffer[(_config.width * y) / 8 + x];
+        uint8_t fill;
+        if (row == nullptr && frame.isRowUniform(y, fill)) {
+            // Uniform rows of sparse frames are sent without reading the frame
+            EINK_STAT(_stats.bytesSent[_plane] += upperByteX - lowerByteX);
+            _transport.writeRepeat(invert ? ~fill : fill, upperByteX - lowerByteX);
+        } else if (row == nullptr) {
+            writePlane(frame.rowData(y) + lowerByteX, upperByteX - lowerByteX, invert);
+        } else {
+            reader.read(y, lowerByteX, upperByteX, row);
+            writePlane(row, upperByteX - lowerByteX, invert);
+        }
 
-            if (black) {
-                writeData(~data);
-            } else {
-                writeData(data);
-            }
+        if (y == maxY - 1 || !fullWidth) {
+            _transport.endData();
         }
     }
+
+    EINK_STAT(endTransfer());
 }
 
-void EInkDisplay::clear() {
-    reset();
-    initialize();
+template<class Transport>
+void BasicEInkDisplay<Transport>::setOrientation(Orientation orientation) {
+    _orientation = orientation;
+}
 
-    writeCommand(0x4F); // reset RAM addr to 0
-    writeData(0x00);
-    writeData(0x00);
+template<class Transport>
+Orientation BasicEInkDisplay<Transport>::getOrientation() const {
+    return _orientation;
+}
 
-    writeCommand(0x24); // write to BW RAM
-    for (uint32_t i = 0; i < _config.width * _config.height / 8; i++) {
-        writeData(0xFF); // white
-    }
+template<class Transport>
+void BasicEInkDisplay<Transport>::clear() {
+    const PanelProfile &panel = *_config.panel;
+    waitIdle();
 
-    writeCommand(0x26); // write to red RAM top->down
-    for (uint32_t i = 0; i < _config.width * _config.height / 8; i++) {
-        writeData(0x00); // white
-    }
+    reset();
+    initialize();
 
-    writeCommand(0x22); // display update control 2
-    writeData(0xC7);
+    fillRam(panel.cmdWriteBlack, panel.clearBlack);
+    fillRam(panel.cmdWriteRed, panel.clearRed);
 
-    writeCommand(0x20); // display
-    delay(10);
-    waitNotBusy();
+    apply();
 }
 
-void EInkDisplay::sleep() {
-    writeCommand(0x10);
-    writeData(0x03);
+template<class Transport>
+void BasicEInkDisplay<Transport>::sleep() {
+    waitIdle();
+    runScript(_config.panel->sleepScript);
 }
 
-void EInkDisplay::wake() {
+template<class Transport>
+void BasicEInkDisplay<Transport>::wake() {
+    waitIdle();
     reset();
     initialize();
 }
 
-void EInkDisplay::writeCommand(uint8_t command) {
-    digitalWrite(_config.dc, LOW);
-    transferSpi(command);
+template<class Transport>
+Transport &BasicEInkDisplay<Transport>::transport() {
+    return _transport;
 }
 
-void EInkDisplay::writeData(uint8_t data) {
-    digitalWrite(_config.dc, HIGH);
-    transferSpi(data);
+#if EINK_STATS
+template<class Transport>
+const DisplayStats &BasicEInkDisplay<Transport>::stats() const {
+    return _stats;
 }
 
-void EInkDisplay::transferSpi(uint8_t data) {
-    digitalWrite(_config.cs, LOW);
-    SPI.transfer(data);
-    digitalWrite(_config.cs, HIGH);
+template<class Transport>
+void BasicEInkDisplay<Transport>::resetStats() {
+    _stats.reset();
 }
 
-void EInkDisplay::waitNotBusy() {
-    do {
-        delay(10); // 10 ms
-    } while (digitalRead(_config.busy));
-    delay(200);
+template<class Transport>
+void BasicEInkDisplay<Transport>::setTraceSink(TraceSink sink) {
+    _trace = sink;
+}
+
+template<class Transport>
+void BasicEInkDisplay<Transport>::beginTransfer(StatPlane plane) {
+    _plane = plane;
+    _transferStart = micros();
+    _transferBytes = _stats.bytesSent[plane];
+}
+
+template<class Transport>
+void BasicEInkDisplay<Transport>::endTransfer() {
+    _stats.spiMicros += micros() - _transferStart;
+    emitTrace(_trace, TRACE_TRANSFER, _plane, _stats.bytesSent[_plane] - _transferBytes);
+    _plane = STAT_PLANE_CONTROL;
+}
+#endif
+
+template<class Transport>
+void BasicEInkDisplay<Transport>::writeCommand(uint8_t command) {
+    EINK_STAT(_stats.commandsSent[_plane]++);
+    _transport.writeCommand(command);
+}
+
+template<class Transport>
+void BasicEInkDisplay<Transport>::writeData(const uint8_t *data, uint32_t length) {
+    EINK_STAT(_stats.bytesSent[_plane] += length);
+    _transport.beginData();
+    _transport.writeData(data, length);
+    _transport.endData();
+}
+
+template<class Transport>
+void BasicEInkDisplay<Transport>::writePlane(const uint8_t *data, uint32_t length, bool invert) {
+    EINK_STAT(_stats.bytesSent[_plane] += length);
+
+    if (!invert) {
+        _transport.writeData(data, length);
+        return;
+    }
+
+    uint8_t chunk[64];
+    while (length > 0) {
+        uint32_t n = min(length, (uint32_t) sizeof(chunk));
+        for (uint32_t i = 0; i < n; i++) {
+            chunk[i] = ~data[i];
+        }
+        _transport.writeData(chunk, n);
+
+        data += n;
+        length -= n;
+    }
 }
 
-void EInkDisplay::initialize() {
-    writeCommand(0x12); // reset
-    waitNotBusy();
+template<class Transport>
+void BasicEInkDisplay<Transport>::setRamAddress(uint16_t x, uint16_t y) {
+    const PanelProfile &panel = *_config.panel;
 
-    writeCommand(0x46); // Auto write for red
-    writeData(0xF7);
-    waitNotBusy();
+    const uint8_t xAddr[] = { (uint8_t) (x & 0xFF), (uint8_t) ((x >> 8) & 0x03) };
+    const uint8_t yAddr[] = { (uint8_t) (y & 0xFF), (uint8_t) ((y >> 8) & 0x03) };
 
-    writeCommand(0x47); // Auto write for white
-    writeData(0xF7);
-    waitNotBusy();
+    writeCommand(panel.cmdRamX);
+    writeData(xAddr, sizeof(xAddr));
 
-    writeCommand(0x0C); // Soft start setting
-    writeData(0xAE);
-    writeData(0xC7);
-    writeData(0xC3);
-    writeData(0xC0);
-    writeData(0x40);   
+    writeCommand(panel.cmdRamY);
+    writeData(yAddr, sizeof(yAddr));
+}
 
-    writeCommand(0x01); // Set MUX as 527
-    writeData(0x0F);
-    writeData(0x02);
-    writeData(0x00);
+template<class Transport>
+void BasicEInkDisplay<Transport>::fillRam(uint8_t command, uint8_t value) {
+    const uint32_t size = (uint32_t) _config.width * _config.height / 8;
+    EINK_STAT(beginTransfer(command == _config.panel->cmdWriteBlack ? STAT_PLANE_BLACK : STAT_PLANE_RED));
 
-    writeCommand(0x11); // Data entry
-    writeData(0x03);    // x+, y+, x+ increment
+    setRamAddress(0, 0);
+    writeCommand(command);
+
+    EINK_STAT(_stats.bytesSent[_plane] += size);
+    _transport.beginData();
+    _transport.writeRepeat(value, size);
+    _transport.endData();
+
+    EINK_STAT(endTransfer());
+}
 
-    writeCommand(0x44); // Start/end pos of RAM x
-    writeData(0x00); // start at 0
-    writeData(0x00);
-    writeData(0x6F); // end at 36F_h = 879
-    writeData(0x03);
+template<class Transport>
+int BasicEInkDisplay<Transport>::runScript(const uint8_t *script, int offset, bool async) {
+    // Data runs are copied out of PROGMEM in chunks, so they can be sent as one burst
+    uint8_t chunk[16];
+
+    // Time spent waiting inside the script is not SPI time
+    EINK_STAT(const uint32_t start = micros());
+    EINK_STAT(const uint32_t waited = _waitMicros);
+
+    int pc = offset;
+    int resume = -1;
+    bool running = true;
+    while (running) {
+        const uint8_t op = pgm_read_byte(script + pc++);
+
+        switch (op) {
+            case SCRIPT_END:
+                running = false;
+                break;
+
+            case SCRIPT_CMD:
+                writeCommand(pgm_read_byte(script + pc++));
+                break;
+
+            case SCRIPT_DATA: {
+                const uint8_t length = pgm_read_byte(script + pc++);
+                EINK_STAT(_stats.bytesSent[_plane] += length);
+
+                _transport.beginData();
+                for (uint8_t sent = 0; sent < length; ) {
+                    uint8_t n = min(length - sent, (int) sizeof(chunk));
+                    for (uint8_t i = 0; i < n; i++) {
+                        chunk[i] = pgm_read_byte(script + pc++);
+                    }
+                    _transport.writeData(chunk, n);
+                    sent += n;
+                }
+                _transport.endData();
+                break;
+            }
 
-    writeCommand(0x45); // Start/end pos of RAM y
-    writeData(0x00);    // start at 0
-    writeData(0x00);
-    writeData(0x0F);    // end at 20F_h = 527
-    writeData(0x02);
+            case SCRIPT_WAIT_BUSY:
+                if (async) {
+                    resume = pc;
+                    running = false;
+                    break;
+                }
+                waitNotBusy();
+                break;
+
+            case SCRIPT_DELAY: {
+                EINK_STAT(const uint32_t delayStart = micros());
+                _transport.delayMs(pgm_read_byte(script + pc++));
+                EINK_STAT(_waitMicros += micros() - delayStart);
+                break;
+            }
 
-    writeCommand(0x3C); // VBD
-    writeData(0x01);    // LUT1, for white
+            default:
+                Serial.printf("Error: unknown script op 0x%02X at offset %d\n", op, pc - 1);
+                running = false;
+                break;
+        }
+    }
 
-    writeCommand(0x18); // Temperature sensor
-    writeData(0X80);    // internal
+    EINK_STAT(_stats.spiMicros += (micros() - start) - (_waitMicros - waited));
+    return resume;
+}
 
-    writeCommand(0x22); // BinaryMatrix update control 2
-    writeData(0XB1);	// Load Temperature and waveform setting.
+template<class Transport>
+void BasicEInkDisplay<Transport>::waitNotBusy() {
+    EINK_STAT(const uint32_t start = micros());
 
-    writeCommand(0x20); // Master activation
-    waitNotBusy();
+    do {
+        _transport.delayMs(BUSY_RISE_MS);
+    } while (_transport.isBusy());
+    _transport.delayMs(BUSY_SETTLE_MS);
+
+#if EINK_STATS
+    const uint32_t elapsed = micros() - start;
+    _stats.busyMicros += elapsed;
+    _waitMicros += elapsed;
+    emitTrace(_trace, TRACE_BUSY, 0, elapsed);
+#endif
+}
 
-    writeCommand(0x4E); // Initial RAM x
-    writeData(0x00);    // addr 0
-    writeData(0x00);
-    writeCommand(0x4F); // Initial RAM y
-    writeData(0x00);    // addr 0
-    writeData(0x00);
+template<class Transport>
+void BasicEInkDisplay<Transport>::initialize() {
+    runScript(_config.panel->initScript);
 }
 
-void EInkDisplay::reset() {
-    digitalWrite(_config.reset, LOW);
-    delay(4);
-    digitalWrite(_config.reset, HIGH);
-    delay(200);
+template<class Transport>
+void BasicEInkDisplay<Transport>::reset() {
+    _transport.setReset(false);
+    _transport.delayMs(4);
+    _transport.setReset(true);
+    _transport.delayMs(200);
 }
 
+// Transports shipped with the library. A custom transport needs to be added here.
+template class BasicEInkDisplay<ArduinoSpiTransport>;
+template class BasicEInkDisplay<FastGpioTransport>;
+#if defined(ESP32)
+template class BasicEInkDisplay<Esp32DmaTransport>;
+#endif
+template class BasicEInkDisplay<RecordingTransport>;
+template class BasicEInkDisplay<EmulatorTransport>;
@@ -1,55 +1,120 @@
 #ifndef eink_display_h
 #define eink_display_h
 
-#include <SPI.h>
 #include <Arduino.h>
 
-class EInkDisplay {
+#include "binary_matrix.h"
+#include "display_transport.h"
+#include "orientation.h"
+#include "panel_profile.h"
+#include "render_stats.h"
+
+/**
+ * Driver for SSD16xx based panels. All bus access goes through the Transport policy
+ * (see display_transport.h), which is chosen at compile time.
+ */
+template<class Transport>
+class BasicEInkDisplay {
 
     // Inner structs/classes
 public:
-    struct Config {
-        int width;
-        int height;
-
-        int cs = 26;
-        int dc = 25;
-        int busy = 33;
-        int reset = 32;
-
-        Config(int width, int height);
-        Config(int width, int height, int cs, int dc, int busy, int reset);
-    };
+    typedef EInkConfig Config;
 
     // Class properties
 private:
-    EInkDisplay::Config _config;
+    Config _config;
+    Transport _transport;
+    Orientation _orientation;
+
+    // BUSY is read no sooner than BUSY_RISE_MS after a refresh starts, as the controller may not
+    // have raised it yet, and the panel is given BUSY_SETTLE_MS more once it drops
+    static const uint32_t BUSY_RISE_MS = 10;
+    static const uint32_t BUSY_SETTLE_MS = 200;
+
+    // Script waiting on BUSY after applyAsync(), continued by isBusy()
+    const uint8_t *_pendingScript = nullptr;
+    int _pendingOffset = 0;
+    uint32_t _pendingSince = 0;     // millis() when the wait, or the settle time, started
+    bool _settling = false;
+
+    // One panel row, for rows that are rotated/mirrored while being sent; allocated on first use
+    uint8_t *_rowBuffer = nullptr;
+
+#if EINK_STATS
+    DisplayStats _stats;
+    TraceSink _trace = nullptr;
+    StatPlane _plane = STAT_PLANE_CONTROL;    // plane that sent bytes are counted against
+    uint32_t _waitMicros = 0;       // total time spent in delays and BUSY waits
+    uint32_t _transferStart = 0;
+    uint32_t _transferBytes = 0;
+    uint32_t _busyStart = 0;        // start of the BUSY wait of an async refresh
+#endif
 
     // Methods
 public:
-    EInkDisplay(EInkDisplay::Config config);
+    BasicEInkDisplay(Config config);
+    ~BasicEInkDisplay();
 
     void setup();
 
-    void writeBuffer(unsigned char* buffer, bool black);
-    void writePartial(unsigned char* buffer, int bufX, int bufY, int bufWidth, int bufHeight, bool black);
+    // The frame is in logical coordinates, it is rotated/mirrored while being sent
+    void writeBuffer(const BinaryMatrix &frame, bool black);
+    void writePartial(const BinaryMatrix &frame, int bufX, int bufY, int bufWidth, int bufHeight, bool black);
     void apply();
 
+    // Starts the refresh and returns without waiting for BUSY. The other calls wait for the
+    // refresh to finish first, so other panels on the bus can be served in the meantime.
+    void applyAsync();
+    // Continues a refresh started by applyAsync() once the panel is no longer busy
+    bool isBusy();
+    void waitIdle();
+
+    void setOrientation(Orientation orientation);
+    Orientation getOrientation() const;
+
     void clear();
     void sleep();
     void wake();
 
+    Transport &transport();
+
+#if EINK_STATS
+    const DisplayStats &stats() const;
+    void resetStats();
+    void setTraceSink(TraceSink sink);
+#endif
+
 private:
     void writeCommand(uint8_t command);
-    void writeData(uint8_t data);
+    void writeData(const uint8_t *data, uint32_t length);
+
+    // Sends a run of plane bytes, inverting them for the black/white RAM if needed
+    void writePlane(const uint8_t *data, uint32_t length, bool invert);
 
-    void transferSpi(uint8_t data);
+    void setRamAddress(uint16_t x, uint16_t y);
+    void fillRam(uint8_t command, uint8_t value);
+
+    // Runs script from offset. With async set it stops at the first BUSY wait and returns the
+    // offset after it; otherwise, or if the script ends, it returns -1.
+    int runScript(const uint8_t *script, int offset = 0, bool async = false);
 
     void waitNotBusy();
 
     void initialize();
     void reset();
 
+#if EINK_STATS
+    void beginTransfer(StatPlane plane);
+    void endTransfer();
+#endif
+
 };
 
+// The transport can be selected per board, e.g. -DEINK_TRANSPORT=Esp32DmaTransport
+#ifndef EINK_TRANSPORT
+#define EINK_TRANSPORT ArduinoSpiTransport
+#endif
+
+typedef BasicEInkDisplay<EINK_TRANSPORT> EInkDisplay;
+
 #endif
@@ -0,0 +1,148 @@
+// Checks that a font compiled by tools/asset_compiler.py draws exactly like the same font parsed
+// at runtime, and prints the time each takes to load and draw.
+//
+// check_font.h is generated from assets/ with --runtime, so it holds the font in both forms:
+//   python3 tools/asset_compiler.py build examples/AssetCheck/assets/assets.txt
+// To check another font, add a line for it to assets.txt and change FONT below.
+
+#include <binary_matrix.h>
+#include <font.h>
+#include <text_cache.h>
+
+#include "check_font.h"
+
+#define FONT checkFont
+#define FONT_DESCRIPTOR checkFont_descriptor
+#define FONT_RGB565 checkFont_rgb565
+
+static const char *SAMPLES[] = {
+    "ABCDEFGHIJKLMNO",
+    "AAHBOCD AA.,EF",
+    " !\"#$%&'()*+,-./",
+    "0123456789:;<=>?@",
+};
+
+static int failures = 0;
+
+static void fail(const char *what, uint32_t id, int expected, int actual) {
+    Serial.printf("FAIL %s (%lu): expected %d, got %d\n", what, (unsigned long) id, expected, actual);
+    failures++;
+}
+
+static void compareGlyphs(const Font &parsed, const Font &compiled) {
+    for (int g = 0; g < FONT.glyphCount; g++) {
+        const char ch = FONT.glyphs[g].id;
+        FontChar a = parsed.getCharacter(ch);
+        FontChar b = compiled.getCharacter(ch);
+
+        if (a.width != b.width) fail("width", a.id, a.width, b.width);
+        if (a.height != b.height) fail("height", a.id, a.height, b.height);
+        if (a.xoffset != b.xoffset) fail("xoffset", a.id, a.xoffset, b.xoffset);
+        if (a.yoffset != b.yoffset) fail("yoffset", a.id, a.yoffset, b.yoffset);
+        if (a.xadvance != b.xadvance) fail("xadvance", a.id, a.xadvance, b.xadvance);
+
+        // The compiled sheet is repacked, so glyph pixels are compared through each font's own x, y
+        int differences = 0;
+        for (int y = 0; y < min(a.height, b.height); y++) {
+            for (int x = 0; x < min(a.width, b.width); x++) {
+                const bool inkA = parsed.getPixel(a.x + x, a.y + y).b <= 1;
+                const bool inkB = compiled.getPixel(b.x + x, b.y + y).b <= 1;
+                differences += inkA != inkB;
+            }
+        }
+        if (differences > 0) fail("pixels differing", a.id, 0, differences);
+    }
+}
+
+static void compareKerning(const Font &parsed, const Font &compiled) {
+    for (int g1 = 0; g1 < FONT.glyphCount; g1++) {
+        for (int g2 = 0; g2 < FONT.glyphCount; g2++) {
+            const char first = FONT.glyphs[g1].id;
+            const char second = FONT.glyphs[g2].id;
+            const int16_t a = parsed.getKerning(first, second);
+            const int16_t b = compiled.getKerning(first, second);
+            if (a != b) fail("kerning", (first << 8) | second, a, b);
+        }
+    }
+}
+
+static void compareText(const Font &parsed, const Font &compiled) {
+    for (const char *text : SAMPLES) {
+        TextExtent a = measureText(parsed, text);
+        TextExtent b = measureText(compiled, text);
+        if (a.advance != b.advance) fail("advance", 0, a.advance, b.advance);
+        if (a.width != b.width) fail("computeWidth", 0, a.width, b.width);
+
+        const int width = a.maxX - a.minX;
+        const int height = a.maxY - a.minY;
+        if (width <= 0 || height <= 0) continue;
+
+        BinaryMatrix drawnA(width, height);
+        BinaryMatrix drawnB(width, height);
+        drawnA.clear();
+        drawnB.clear();
+        rasterizeText(parsed, text, drawnA, -a.minX, -a.minY, true, Rect(0, 0, width, height));
+        rasterizeText(compiled, text, drawnB, -a.minX, -a.minY, true, Rect(0, 0, width, height));
+
+        int differences = 0;
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                differences += drawnA.getPixel(x, y) != drawnB.getPixel(x, y);
+            }
+        }
+        if (differences > 0) {
+            Serial.printf("FAIL text \"%s\": %d pixels differ\n", text, differences);
+            failures++;
+        }
+    }
+}
+
+static void check(Font &parsed, Font &compiled, float scale) {
+    parsed.setScale(scale);
+    compiled.setScale(scale);
+
+    const int before = failures;
+    compareGlyphs(parsed, compiled);
+    compareKerning(parsed, compiled);
+    compareText(parsed, compiled);
+    Serial.printf("scale %.1f: %s\n", scale, failures == before ? "ok" : "FAILED");
+}
+
+static void timeText(const char *label, const Font &font) {
+    BinaryMatrix target(400, 40);
+    target.clear();
+
+    const uint32_t start = micros();
+    for (const char *text : SAMPLES) {
+        rasterizeText(font, text, target, 0, 10, true, Rect(0, 0, 400, 40));
+    }
+    Serial.printf("%s: draw %lu us\n", label, (unsigned long) (micros() - start));
+}
+
+void setup() {
+    Serial.begin(115200);
+
+    uint32_t start = micros();
+    Font parsed(Image::asImage(&FONT_RGB565), FONT_DESCRIPTOR);
+    const uint32_t parseMicros = micros() - start;
+
+    start = micros();
+    Font compiled(FONT);
+    const uint32_t compiledMicros = micros() - start;
+
+    Serial.printf("load: parsed %lu us, compiled %lu us\n", (unsigned long) parseMicros, (unsigned long) compiledMicros);
+    Serial.printf("glyph data: RGB565 %u bytes, 1-bit %u bytes\n",
+        (unsigned) sizeof(FONT_RGB565.pixel_data), (unsigned) (FONT.sheet.height * ((FONT.sheet.width + 7) / 8)));
+
+    check(parsed, compiled, 1.0f);
+    check(parsed, compiled, 2.0f);
+
+    timeText("parsed", parsed);
+    timeText("compiled", compiled);
+
+    Serial.println(failures == 0 ? "AssetCheck passed" : "AssetCheck FAILED");
+}
+
+void loop() {
+    delay(1000);
+}
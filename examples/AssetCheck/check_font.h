@@ -0,0 +1,630 @@
+// Generated by tools/asset_compiler.py from check.fnt. Do not edit.
+
+#ifndef checkFont_asset_h
+#define checkFont_asset_h
+
+#include <compiled_asset.h>
+
+static constexpr uint8_t checkFont_bits[] PROGMEM = {
+    0x05, 0x11, 0x2C, 0x04, 0x12, 0x6B, 0x87, 0x12, 0x41, 0x05, 0x14, 0x06, 0x12, 0x04, 0x04, 0x44,
+    0xA6, 0x41, 0x1A, 0x00, 0x42, 0x12, 0xC9, 0x21, 0x0D, 0x40, 0x42, 0x00, 0x0D, 0x40, 0x4C, 0x24,
+    0x12, 0x50, 0x08, 0x75, 0x81, 0x18, 0x13, 0x43, 0x61, 0x62, 0x40, 0x06, 0x24, 0x6A, 0x0E, 0x05,
+    0xA4, 0x44, 0x28, 0x18, 0x0B, 0x04, 0x04, 0x6D, 0x18, 0x08, 0x08, 0x04, 0x02, 0x32, 0x22, 0x46,
+    0x16, 0x24, 0xA4, 0x40, 0xE6, 0x00, 0x60, 0xA0, 0x49, 0x3B, 0x00, 0x34, 0x82, 0x72, 0x51, 0xB3,
+    0x54, 0x88, 0x00, 0xA5, 0xD1, 0xCA, 0x71, 0xC8, 0x80, 0x14, 0x02, 0xE1, 0x00, 0x00, 0x1A, 0x62,
+    0x02, 0x0D, 0xB4, 0xC2, 0xC4, 0xA2, 0x00, 0x04, 0x78, 0x23, 0x0A, 0x19, 0x48, 0x14, 0x06, 0x51,
+    0x20, 0x96, 0x2C, 0x80, 0x4A, 0x18, 0x12, 0x08, 0x06, 0xA0, 0x80, 0xEA, 0xB0, 0x01, 0x00, 0x12,
+    0x58, 0x04, 0xAC, 0x24, 0x85, 0x01, 0x20, 0xC3, 0x13, 0xA4, 0x29, 0xD0, 0x5C, 0x05, 0x9A, 0x00,
+    0x07, 0x00, 0x8D, 0x24, 0x20, 0x03, 0x00, 0x10, 0x42, 0x84, 0x80, 0x02, 0x06, 0x20, 0x00, 0x00,
+    0x10, 0x18, 0x24, 0x30, 0x34, 0x80, 0x5D, 0x06, 0xA0, 0x30, 0x00, 0x4C, 0xA1, 0x64, 0x11, 0x10,
+    0x28, 0x17, 0x28, 0x0A, 0x40, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x14, 0x05, 0x80, 0x00, 0x01, 0x12, 0x61, 0x22, 0x00, 0x08, 0x26, 0x20, 0x6A, 0x04, 0x20,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x0C, 0x8E, 0x00, 0x28, 0x32, 0x22, 0x09, 0x4C, 0x04, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0D, 0x00, 0x20, 0x0E, 0x2A, 0x88, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static constexpr CompiledGlyph checkFont_glyphs[] PROGMEM = {
+    // id, x, y, width, height, xoffset, yoffset, xadvance
+    { 32, 57, 0, 4, 8, -1, 2, 5 },
+    { 33, 61, 0, 8, 8, 0, 1, 9 },
+    { 34, 69, 0, 4, 8, 2, 2, 5 },
+    { 35, 181, 0, 5, 5, 1, 3, 6 },
+    { 36, 186, 0, 7, 5, -1, 2, 8 },
+    { 37, 236, 0, 8, 4, 0, 0, 9 },
+    { 38, 0, 0, 5, 9, 0, 2, 6 },
+    { 39, 73, 0, 6, 8, 2, 0, 7 },
+    { 40, 5, 0, 3, 9, 1, 2, 4 },
+    { 41, 79, 0, 5, 8, 2, 2, 6 },
+    { 42, 136, 0, 6, 6, 2, 0, 7 },
+    { 43, 103, 0, 7, 7, -1, 2, 8 },
+    { 44, 8, 0, 8, 9, 1, 1, 9 },
+    { 45, 84, 0, 3, 8, 1, 3, 4 },
+    { 46, 193, 0, 3, 5, 1, 1, 4 },
+    { 47, 110, 0, 5, 7, 1, 3, 6 },
+    { 48, 87, 0, 3, 8, 2, 2, 4 },
+    { 49, 142, 0, 5, 6, 0, 3, 6 },
+    { 50, 147, 0, 7, 6, 0, 2, 8 },
+    { 51, 16, 0, 8, 9, 1, 0, 9 },
+    { 52, 115, 0, 4, 7, 1, 2, 5 },
+    { 53, 154, 0, 7, 6, 1, 1, 8 },
+    { 54, 24, 0, 7, 9, 2, 1, 8 },
+    { 55, 90, 0, 3, 8, 2, 2, 4 },
+    { 56, 119, 0, 3, 7, 0, 2, 4 },
+    { 57, 122, 0, 3, 7, 2, 0, 4 },
+    { 58, 93, 0, 5, 8, 1, 1, 6 },
+    { 59, 196, 0, 4, 5, 2, 1, 5 },
+    { 60, 200, 0, 6, 5, 0, 1, 7 },
+    { 61, 161, 0, 3, 6, 2, 0, 4 },
+    { 62, 244, 0, 4, 4, 2, 1, 5 },
+    { 63, 206, 0, 7, 5, 1, 0, 8 },
+    { 64, 98, 0, 5, 8, 2, 2, 6 },
+    { 65, 164, 0, 4, 6, -1, 1, 5 },
+    { 66, 31, 0, 6, 9, 0, 1, 7 },
+    { 67, 213, 0, 3, 5, 1, 2, 4 },
+    { 68, 125, 0, 6, 7, 1, 2, 7 },
+    { 69, 248, 0, 8, 4, 1, 1, 9 },
+    { 70, 168, 0, 6, 6, 1, 1, 7 },
+    { 71, 37, 0, 8, 9, -1, 3, 9 },
+    { 72, 45, 0, 4, 9, 2, 2, 5 },
+    { 73, 174, 0, 3, 6, 0, 3, 4 },
+    { 74, 216, 0, 8, 5, -1, 1, 9 },
+    { 75, 131, 0, 5, 7, 0, 2, 6 },
+    { 76, 177, 0, 4, 6, 2, 3, 5 },
+    { 77, 49, 0, 8, 9, 0, 3, 9 },
+    { 78, 224, 0, 4, 5, 0, 0, 5 },
+    { 79, 228, 0, 8, 5, -1, 3, 9 },
+};
+
+static constexpr CompiledKerning checkFont_kerning[] PROGMEM = {
+    { 65, 65, 5 },
+    { 66, 72, 1 },
+    { 67, 79, 0 },
+    { 68, 71, -1 },
+    { 69, 78, 1 },
+    { 70, 70, 0 },
+    { 71, 77, -1 },
+    { 72, 69, 1 },
+    { 73, 76, 0 },
+    { 74, 68, -1 },
+    { 75, 75, 1 },
+    { 76, 67, 0 },
+    { 77, 74, -1 },
+    { 78, 66, 1 },
+    { 79, 73, 0 },
+    { 84, 111, -2 },
+};
+
+static constexpr CompiledFont checkFont = {
+    12, 10,
+    { 256, 9, checkFont_bits },
+    checkFont_glyphs, 48,
+    checkFont_kerning, 16,
+};
+
+// Runtime format: Font(Image::asImage(&checkFont_rgb565), checkFont_descriptor)
+static const unsigned char checkFont_descriptor[] PROGMEM = {
+    0x42, 0x4D, 0x46, 0x03, 0x01, 0x19, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x64, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x73, 0x73, 0x65, 0x74, 0x43, 0x68, 0x65, 0x63,
+    0x6B, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0A, 0x00, 0x40, 0x00, 0x36, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0A, 0x00, 0x00, 0x00, 0x63, 0x68, 0x65, 0x63, 0x6B,
+    0x2E, 0x70, 0x6E, 0x67, 0x00, 0x04, 0xC0, 0x03, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0xFF, 0xFF, 0x02, 0x00, 0x05, 0x00, 0x00, 0x0F, 0x21, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x00,
+    0x00, 0x0F, 0x22, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x02, 0x00,
+    0x02, 0x00, 0x05, 0x00, 0x00, 0x0F, 0x23, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x05, 0x00,
+    0x05, 0x00, 0x01, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x0F, 0x24, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0x00, 0x00, 0x07, 0x00, 0x05, 0x00, 0xFF, 0xFF, 0x02, 0x00, 0x08, 0x00, 0x00, 0x0F, 0x25, 0x00,
+    0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+    0x00, 0x0F, 0x26, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x06, 0x00, 0x00, 0x0F, 0x27, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0x00, 0x03, 0x00, 0x09, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x0F, 0x29, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x09, 0x00, 0x05, 0x00, 0x08, 0x00, 0x02, 0x00, 0x02, 0x00, 0x06, 0x00,
+    0x00, 0x0F, 0x2A, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x06, 0x00, 0x06, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x2B, 0x00, 0x00, 0x00, 0x18, 0x00, 0x09, 0x00, 0x07, 0x00,
+    0x07, 0x00, 0xFF, 0xFF, 0x02, 0x00, 0x08, 0x00, 0x00, 0x0F, 0x2C, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0x09, 0x00, 0x08, 0x00, 0x09, 0x00, 0x01, 0x00, 0x01, 0x00, 0x09, 0x00, 0x00, 0x0F, 0x2D, 0x00,
+    0x00, 0x00, 0x28, 0x00, 0x09, 0x00, 0x03, 0x00, 0x08, 0x00, 0x01, 0x00, 0x03, 0x00, 0x04, 0x00,
+    0x00, 0x0F, 0x2E, 0x00, 0x00, 0x00, 0x30, 0x00, 0x09, 0x00, 0x03, 0x00, 0x05, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x04, 0x00, 0x00, 0x0F, 0x2F, 0x00, 0x00, 0x00, 0x38, 0x00, 0x09, 0x00, 0x05, 0x00,
+    0x07, 0x00, 0x01, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x0F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x00, 0x03, 0x00, 0x08, 0x00, 0x02, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x0F, 0x31, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x12, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00,
+    0x00, 0x0F, 0x32, 0x00, 0x00, 0x00, 0x10, 0x00, 0x12, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x08, 0x00, 0x00, 0x0F, 0x33, 0x00, 0x00, 0x00, 0x18, 0x00, 0x12, 0x00, 0x08, 0x00,
+    0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x0F, 0x34, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0x12, 0x00, 0x04, 0x00, 0x07, 0x00, 0x01, 0x00, 0x02, 0x00, 0x05, 0x00, 0x00, 0x0F, 0x35, 0x00,
+    0x00, 0x00, 0x28, 0x00, 0x12, 0x00, 0x07, 0x00, 0x06, 0x00, 0x01, 0x00, 0x01, 0x00, 0x08, 0x00,
+    0x00, 0x0F, 0x36, 0x00, 0x00, 0x00, 0x30, 0x00, 0x12, 0x00, 0x07, 0x00, 0x09, 0x00, 0x02, 0x00,
+    0x01, 0x00, 0x08, 0x00, 0x00, 0x0F, 0x37, 0x00, 0x00, 0x00, 0x38, 0x00, 0x12, 0x00, 0x03, 0x00,
+    0x08, 0x00, 0x02, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x0F, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x0F, 0x39, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x1B, 0x00, 0x03, 0x00, 0x07, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x0F, 0x3A, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1B, 0x00, 0x05, 0x00, 0x08, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x06, 0x00, 0x00, 0x0F, 0x3B, 0x00, 0x00, 0x00, 0x18, 0x00, 0x1B, 0x00, 0x04, 0x00,
+    0x05, 0x00, 0x02, 0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0x0F, 0x3C, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0x1B, 0x00, 0x06, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x3D, 0x00,
+    0x00, 0x00, 0x28, 0x00, 0x1B, 0x00, 0x03, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x0F, 0x3E, 0x00, 0x00, 0x00, 0x30, 0x00, 0x1B, 0x00, 0x04, 0x00, 0x04, 0x00, 0x02, 0x00,
+    0x01, 0x00, 0x05, 0x00, 0x00, 0x0F, 0x3F, 0x00, 0x00, 0x00, 0x38, 0x00, 0x1B, 0x00, 0x07, 0x00,
+    0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x05, 0x00, 0x08, 0x00, 0x02, 0x00, 0x02, 0x00, 0x06, 0x00, 0x00, 0x0F, 0x41, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x24, 0x00, 0x04, 0x00, 0x06, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0x05, 0x00,
+    0x00, 0x0F, 0x42, 0x00, 0x00, 0x00, 0x10, 0x00, 0x24, 0x00, 0x06, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x43, 0x00, 0x00, 0x00, 0x18, 0x00, 0x24, 0x00, 0x03, 0x00,
+    0x05, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x0F, 0x44, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0x24, 0x00, 0x06, 0x00, 0x07, 0x00, 0x01, 0x00, 0x02, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x45, 0x00,
+    0x00, 0x00, 0x28, 0x00, 0x24, 0x00, 0x08, 0x00, 0x04, 0x00, 0x01, 0x00, 0x01, 0x00, 0x09, 0x00,
+    0x00, 0x0F, 0x46, 0x00, 0x00, 0x00, 0x30, 0x00, 0x24, 0x00, 0x06, 0x00, 0x06, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x47, 0x00, 0x00, 0x00, 0x38, 0x00, 0x24, 0x00, 0x08, 0x00,
+    0x09, 0x00, 0xFF, 0xFF, 0x03, 0x00, 0x09, 0x00, 0x00, 0x0F, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x00, 0x04, 0x00, 0x09, 0x00, 0x02, 0x00, 0x02, 0x00, 0x05, 0x00, 0x00, 0x0F, 0x49, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x2D, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00,
+    0x00, 0x0F, 0x4A, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2D, 0x00, 0x08, 0x00, 0x05, 0x00, 0xFF, 0xFF,
+    0x01, 0x00, 0x09, 0x00, 0x00, 0x0F, 0x4B, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2D, 0x00, 0x05, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0x00, 0x00, 0x0F, 0x4C, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0x2D, 0x00, 0x04, 0x00, 0x06, 0x00, 0x02, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x0F, 0x4D, 0x00,
+    0x00, 0x00, 0x28, 0x00, 0x2D, 0x00, 0x08, 0x00, 0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x09, 0x00,
+    0x00, 0x0F, 0x4E, 0x00, 0x00, 0x00, 0x30, 0x00, 0x2D, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x0F, 0x4F, 0x00, 0x00, 0x00, 0x38, 0x00, 0x2D, 0x00, 0x08, 0x00,
+    0x05, 0x00, 0xFF, 0xFF, 0x03, 0x00, 0x09, 0x00, 0x00, 0x0F, 0x05, 0xAA, 0x00, 0x00, 0x00, 0x41,
+    0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x42, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x43, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00,
+    0x00, 0x47, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x45, 0x00, 0x00, 0x00, 0x4E, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x46, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x4D,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x48, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x01, 0x00, 0x49,
+    0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x4B, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x01, 0x00, 0x4C, 0x00, 0x00,
+    0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x00, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0x4E, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x01, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x49,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x41,
+    0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x05, 0x00,
+};
+
+static const struct {
+    unsigned int width;
+    unsigned int height;
+    unsigned int bytes_per_pixel;
+    unsigned char pixel_data[6912];
+} checkFont_rgb565 PROGMEM = {
+    64, 54, 2,
+    {
+        0x59, 0xCE, 0x03, 0x08, 0x01, 0x10, 0x12, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x00, 0x10, 0x59, 0xCE, 0xFF, 0xFF, 0x01, 0x10, 0x19, 0xE7, 0x02, 0x08, 0xFF, 0xFF,
+        0x02, 0x08, 0x14, 0xE7, 0x01, 0x00, 0x03, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x4B, 0xCE, 0x03, 0x00, 0x00, 0x08, 0x1A, 0xE7, 0x16, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x00, 0x1B, 0xE7, 0x19, 0xE7, 0xFF, 0xFF, 0x03, 0x08, 0x01, 0x08, 0x03, 0x10, 0xFF, 0xFF,
+        0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xCE, 0x16, 0xE7, 0x01, 0x08, 0x03, 0x08, 0x02, 0x08,
+        0xFF, 0xFF, 0x51, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x00, 0x16, 0xE7, 0x48, 0xCE, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x08, 0x59, 0xCE, 0xFF, 0xFF, 0x54, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x10, 0x00, 0x10, 0x01, 0x00, 0xFF, 0xFF, 0x01, 0x10, 0x01, 0x08, 0x02, 0x10, 0x1A, 0xE7,
+        0x1E, 0xE7, 0x03, 0x10, 0x01, 0x00, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x00, 0x19, 0xE7, 0x02, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x01, 0x08, 0xFF, 0xFF, 0x00, 0x08, 0x02, 0x08, 0xFF, 0xFF,
+        0x5E, 0xCE, 0x4A, 0xCE, 0x00, 0x10, 0x18, 0xE7, 0xFF, 0xFF, 0x14, 0xE7, 0x00, 0x08, 0x14, 0xE7,
+        0x02, 0x10, 0xFF, 0xFF, 0x02, 0x08, 0x01, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x03, 0x10, 0xFF, 0xFF, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x42, 0xCE, 0x00, 0x10, 0xFF, 0xFF, 0x02, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x00, 0x02, 0x00, 0x5C, 0xCE, 0x1D, 0xE7, 0x00, 0x00, 0x4F, 0xCE, 0x4A, 0xCE, 0x00, 0x10,
+        0x02, 0x00, 0x1F, 0xE7, 0x00, 0x10, 0x1F, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x4E, 0xCE, 0x02, 0x00, 0x00, 0x10, 0x01, 0x08, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x1F, 0xE7, 0xFF, 0xFF, 0x01, 0x08, 0x5F, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x02, 0x00, 0x03, 0x08, 0x02, 0x00, 0x13, 0xE7, 0x5E, 0xCE, 0x02, 0x00, 0x00, 0x10,
+        0x59, 0xCE, 0x02, 0x00, 0xFF, 0xFF, 0x00, 0x10, 0x1F, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x46, 0xCE, 0x01, 0x00, 0x00, 0x00, 0x01, 0x08, 0x4D, 0xCE, 0x01, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x00, 0x02, 0x08, 0x02, 0x00, 0x03, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x00, 0x03, 0x10, 0x02, 0x08, 0xFF, 0xFF, 0x00, 0x08, 0x01, 0x08, 0x01, 0x00, 0x00, 0x10,
+        0x02, 0x08, 0x12, 0xE7, 0x44, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x1D, 0xE7, 0x00, 0x00, 0x12, 0xE7, 0x03, 0x10, 0x4A, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x00, 0x1E, 0xE7, 0x01, 0x00, 0x03, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xFF, 0xFF,
+        0x02, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x16, 0xE7, 0xFF, 0xFF, 0x51, 0xCE, 0x16, 0xE7,
+        0x5C, 0xCE, 0xFF, 0xFF, 0x03, 0x08, 0xFF, 0xFF, 0x12, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x08, 0x5E, 0xCE, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x00, 0xFF, 0xFF, 0x02, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x4F, 0xCE, 0x00, 0x08, 0x01, 0x00, 0x1B, 0xE7, 0xFF, 0xFF, 0x18, 0xE7, 0x00, 0x10, 0x03, 0x10,
+        0x11, 0xE7, 0x00, 0x00, 0x01, 0x10, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x11, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x47, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x01, 0x00, 0x02, 0x10, 0x11, 0xE7, 0xFF, 0xFF, 0x03, 0x10, 0x02, 0x00, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x50, 0xCE, 0x01, 0x00, 0xFF, 0xFF, 0x00, 0x08, 0x41, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x42, 0xCE, 0x00, 0x10, 0x49, 0xCE, 0x03, 0x10, 0x00, 0x00, 0x52, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x10, 0xFF, 0xFF, 0x02, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x10, 0x00, 0x08, 0x5D, 0xCE, 0x01, 0x00, 0xFF, 0xFF, 0x01, 0x10, 0x03, 0x10, 0x54, 0xCE,
+        0xFF, 0xFF, 0x17, 0xE7, 0x19, 0xE7, 0x1B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x5F, 0xCE, 0xFF, 0xFF, 0x1A, 0xE7, 0x00, 0x00, 0x49, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x08, 0x00, 0x00, 0x00, 0x10, 0x57, 0xCE, 0x16, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x00, 0x01, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x19, 0xE7, 0x02, 0x10, 0x01, 0x00, 0x02, 0x10, 0x54, 0xCE, 0x01, 0x08, 0x10, 0xE7, 0x16, 0xE7,
+        0x02, 0x00, 0x00, 0x00, 0x1F, 0xE7, 0x15, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x02, 0x10, 0x02, 0x10, 0x13, 0xE7, 0xFF, 0xFF, 0x02, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x49, 0xCE, 0xFF, 0xFF, 0x02, 0x08, 0xFF, 0xFF, 0x1E, 0xE7, 0x52, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x11, 0xE7, 0x44, 0xCE, 0x16, 0xE7, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x00, 0x03, 0x10, 0x00, 0x08, 0x03, 0x00, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+        0x00, 0x08, 0x02, 0x08, 0x12, 0xE7, 0x03, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x10, 0x03, 0x08, 0x58, 0xCE, 0x02, 0x10, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x19, 0xE7, 0xFF, 0xFF, 0x02, 0x10, 0x11, 0xE7, 0x00, 0x00, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x1A, 0xE7, 0x03, 0x08, 0x1D, 0xE7, 0x02, 0x10, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x10, 0x12, 0xE7, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x08, 0x03, 0x08, 0x4D, 0xCE, 0x5A, 0xCE, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x02, 0x08, 0x01, 0x00, 0xFF, 0xFF, 0x11, 0xE7, 0x03, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x02, 0x08, 0x47, 0xCE, 0xFF, 0xFF, 0x19, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x08, 0xFF, 0xFF,
+        0x1A, 0xE7, 0x02, 0x10, 0xFF, 0xFF, 0x01, 0x08, 0x1A, 0xE7, 0xFF, 0xFF, 0x46, 0xCE, 0x01, 0x08,
+        0x5F, 0xCE, 0x00, 0x10, 0x4E, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x1F, 0xE7, 0x03, 0x00, 0x55, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x08, 0x54, 0xCE, 0x1C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x00, 0x00, 0x08, 0x49, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x49, 0xCE, 0x1C, 0xE7, 0x01, 0x10, 0x02, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x00, 0x01, 0x00, 0x03, 0x08, 0xFF, 0xFF, 0x1C, 0xE7, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x08, 0x1B, 0xE7, 0x01, 0x10, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0x08, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x01, 0x10, 0x02, 0x08, 0x00, 0x08, 0x19, 0xE7, 0xFF, 0xFF, 0x53, 0xCE, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x58, 0xCE, 0x19, 0xE7, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x00, 0x4B, 0xCE, 0xFF, 0xFF, 0x12, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x08, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x00, 0x53, 0xCE, 0x13, 0xE7, 0x55, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x08, 0x03, 0x00, 0x02, 0x00, 0x1F, 0xE7, 0x01, 0x10, 0x1B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x5E, 0xCE, 0xFF, 0xFF, 0x01, 0x08, 0x01, 0x08, 0x01, 0x08, 0x14, 0xE7, 0x02, 0x00, 0xFF, 0xFF,
+        0x03, 0x00, 0x56, 0xCE, 0x01, 0x08, 0x46, 0xCE, 0x16, 0xE7, 0x00, 0x10, 0x02, 0x10, 0x52, 0xCE,
+        0x03, 0x08, 0x02, 0x10, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x43, 0xCE, 0x43, 0xCE, 0x16, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x10, 0x03, 0x00, 0xFF, 0xFF, 0x01, 0x10, 0x58, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x08, 0x00, 0x08, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x00, 0x02, 0x10, 0x43, 0xCE, 0xFF, 0xFF, 0x18, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x08, 0x18, 0xE7, 0x44, 0xCE, 0x00, 0x00, 0x12, 0xE7, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x1B, 0xE7, 0xFF, 0xFF, 0x02, 0x00, 0x5D, 0xCE, 0x01, 0x08, 0x03, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+        0x55, 0xCE, 0x03, 0x10, 0x4F, 0xCE, 0xFF, 0xFF, 0x01, 0x08, 0x00, 0x08, 0x02, 0x00, 0x41, 0xCE,
+        0x00, 0x08, 0x48, 0xCE, 0x01, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x02, 0x10, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x02, 0x08, 0x49, 0xCE, 0xFF, 0xFF, 0x51, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x15, 0xE7, 0xFF, 0xFF, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x08, 0x1B, 0xE7, 0x02, 0x00, 0x01, 0x00, 0x02, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x47, 0xCE, 0x03, 0x10, 0x52, 0xCE, 0x4C, 0xCE, 0x5E, 0xCE, 0x1B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x10, 0x53, 0xCE, 0xFF, 0xFF, 0x02, 0x10, 0x17, 0xE7, 0x03, 0x00, 0x00, 0x10, 0xFF, 0xFF,
+        0x54, 0xCE, 0x1C, 0xE7, 0xFF, 0xFF, 0x1A, 0xE7, 0xFF, 0xFF, 0x00, 0x10, 0x03, 0x08, 0x03, 0x00,
+        0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x08, 0x16, 0xE7, 0x46, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x01, 0x08, 0x00, 0x00, 0x4F, 0xCE, 0x03, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0x52, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x13, 0xE7, 0x1D, 0xE7, 0x02, 0x00, 0xFF, 0xFF, 0x11, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x58, 0xCE, 0x1B, 0xE7, 0x03, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x00, 0x1E, 0xE7, 0x01, 0x10, 0x01, 0x08, 0x03, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x03, 0x10, 0xFF, 0xFF, 0x01, 0x08, 0x01, 0x08, 0xFF, 0xFF, 0x45, 0xCE, 0x03, 0x00,
+        0x18, 0xE7, 0x1B, 0xE7, 0x5B, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x1D, 0xE7, 0x44, 0xCE, 0x11, 0xE7, 0x47, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x1D, 0xE7, 0x13, 0xE7, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x11, 0xE7, 0x4F, 0xCE, 0x02, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x12, 0xE7, 0x02, 0x08, 0x00, 0x00, 0x01, 0x08, 0xFF, 0xFF, 0x01, 0x08, 0x03, 0x08, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x1E, 0xE7, 0xFF, 0xFF, 0x01, 0x00, 0x5F, 0xCE, 0x00, 0x00, 0x02, 0x08, 0x02, 0x08,
+        0x01, 0x08, 0xFF, 0xFF, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x08, 0x03, 0x10, 0x11, 0xE7, 0x4F, 0xCE, 0x46, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x02, 0x00, 0x03, 0x08, 0x19, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x02, 0x08, 0x1C, 0xE7, 0xFF, 0xFF, 0x19, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x02, 0x08, 0x58, 0xCE, 0x02, 0x08, 0x03, 0x08, 0x00, 0x00, 0x00, 0x08, 0x56, 0xCE, 0x17, 0xE7,
+        0xFF, 0xFF, 0x01, 0x00, 0x01, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x08, 0x02, 0x10, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x1D, 0xE7, 0xFF, 0xFF, 0x1F, 0xE7, 0x03, 0x08, 0x58, 0xCE, 0x4D, 0xCE, 0x14, 0xE7, 0x56, 0xCE,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x03, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x00, 0x10, 0x14, 0xE7, 0xFF, 0xFF, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x10, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x08, 0x03, 0x00, 0x02, 0x10, 0x1F, 0xE7, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x15, 0xE7, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x10, 0x00, 0x10, 0xFF, 0xFF, 0x4E, 0xCE,
+        0x03, 0x08, 0x5A, 0xCE, 0x01, 0x08, 0x14, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x53, 0xCE, 0x03, 0x08, 0x02, 0x00, 0x4B, 0xCE, 0x1F, 0xE7, 0x03, 0x08, 0x1E, 0xE7, 0xFF, 0xFF,
+        0x02, 0x08, 0xFF, 0xFF, 0x1F, 0xE7, 0x5A, 0xCE, 0x02, 0x00, 0x00, 0x08, 0x02, 0x10, 0xFF, 0xFF,
+        0x5B, 0xCE, 0x12, 0xE7, 0x03, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x08, 0x02, 0x00, 0x1E, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x14, 0xE7, 0x02, 0x08, 0x49, 0xCE, 0x02, 0x08, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x19, 0xE7, 0x01, 0x10, 0x03, 0x10, 0x02, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0xE7, 0xFF, 0xFF,
+        0x59, 0xCE, 0xFF, 0xFF, 0x02, 0x10, 0x1F, 0xE7, 0x00, 0x00, 0x02, 0x10, 0x12, 0xE7, 0x5D, 0xCE,
+        0x14, 0xE7, 0x41, 0xCE, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x4E, 0xCE, 0x01, 0x10, 0x01, 0x08, 0x13, 0xE7, 0x02, 0x10, 0x19, 0xE7, 0x56, 0xCE, 0xFF, 0xFF,
+        0x1A, 0xE7, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x12, 0xE7, 0x01, 0x08, 0x54, 0xCE, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x5F, 0xCE, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x02, 0x08, 0x5A, 0xCE, 0x19, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x5B, 0xCE, 0xFF, 0xFF, 0x03, 0x08, 0x11, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x13, 0xE7, 0x18, 0xE7, 0x1D, 0xE7, 0x14, 0xE7, 0x03, 0x10, 0x01, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x00, 0x5C, 0xCE, 0x00, 0x00, 0x4B, 0xCE, 0x53, 0xCE, 0x01, 0x08, 0x18, 0xE7, 0x47, 0xCE,
+        0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x08, 0x02, 0x10, 0x5D, 0xCE, 0x00, 0x08, 0x57, 0xCE, 0x00, 0x10, 0x00, 0x00, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x01, 0x08, 0x5A, 0xCE, 0x49, 0xCE, 0xFF, 0xFF, 0x03, 0x00, 0x17, 0xE7, 0xFF, 0xFF,
+        0x00, 0x00, 0x00, 0x10, 0x02, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x10, 0x16, 0xE7, 0x03, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x08, 0xFF, 0xFF, 0x02, 0x10, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x08, 0x00, 0x10, 0x00, 0x08, 0x4C, 0xCE, 0x02, 0x10, 0x00, 0x08, 0x02, 0x08, 0xFF, 0xFF,
+        0x00, 0x00, 0x1B, 0xE7, 0x01, 0x08, 0x00, 0x10, 0x44, 0xCE, 0x01, 0x00, 0x44, 0xCE, 0xFF, 0xFF,
+        0x50, 0xCE, 0x4C, 0xCE, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x03, 0x08, 0xFF, 0xFF, 0x4D, 0xCE, 0x03, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x00, 0x01, 0x08, 0x17, 0xE7, 0x13, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x10, 0x00, 0x10, 0x01, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x02, 0x00, 0x1C, 0xE7, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x5B, 0xCE, 0x01, 0x00, 0x00, 0x10, 0x03, 0x08, 0x00, 0x08, 0x02, 0x10, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x08, 0x03, 0x08, 0x00, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0x08,
+        0x41, 0xCE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x08, 0x02, 0x10, 0x5C, 0xCE, 0x00, 0x08, 0x03, 0x08, 0x1F, 0xE7, 0x5B, 0xCE, 0xFF, 0xFF,
+        0x54, 0xCE, 0x03, 0x00, 0x00, 0x00, 0x4E, 0xCE, 0x02, 0x08, 0x01, 0x08, 0x02, 0x08, 0xFF, 0xFF,
+        0x02, 0x08, 0x00, 0x10, 0x02, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x02, 0x08, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x08, 0x00, 0x10, 0x02, 0x00, 0xFF, 0xFF, 0x01, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x1A, 0xE7, 0x01, 0x08, 0x50, 0xCE, 0x4E, 0xCE, 0x55, 0xCE, 0xFF, 0xFF, 0x02, 0x00, 0xFF, 0xFF,
+        0x03, 0x08, 0x02, 0x00, 0x01, 0x00, 0x03, 0x08, 0xFF, 0xFF, 0x00, 0x08, 0x03, 0x00, 0x1E, 0xE7,
+        0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x50, 0xCE, 0xFF, 0xFF, 0x00, 0x10, 0x16, 0xE7, 0x00, 0x08, 0x4B, 0xCE, 0x02, 0x10, 0xFF, 0xFF,
+        0x02, 0x08, 0x15, 0xE7, 0x00, 0x08, 0x00, 0x08, 0x19, 0xE7, 0x03, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x13, 0xE7, 0xFF, 0xFF, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x17, 0xE7, 0xFF, 0xFF, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x03, 0x00, 0x1E, 0xE7, 0x1F, 0xE7, 0x16, 0xE7, 0x01, 0x08, 0x02, 0x08, 0x01, 0x00,
+        0x02, 0x08, 0x03, 0x00, 0x01, 0x10, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x10, 0x1D, 0xE7, 0x03, 0x08, 0x48, 0xCE, 0x03, 0x00, 0x49, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x10, 0x58, 0xCE, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x00, 0xFF, 0xFF, 0x03, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x10, 0xFF, 0xFF, 0x02, 0x08, 0x45, 0xCE, 0x01, 0x10, 0x01, 0x10, 0x01, 0x08, 0x02, 0x00,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x15, 0xE7, 0x16, 0xE7, 0x03, 0x10, 0x4E, 0xCE, 0x1E, 0xE7, 0x15, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x11, 0xE7, 0x47, 0xCE, 0x5B, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x08, 0x02, 0x00, 0x01, 0x00, 0xFF, 0xFF, 0x1A, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x1B, 0xE7,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x10, 0xE7, 0x1F, 0xE7, 0xFF, 0xFF, 0x48, 0xCE, 0x01, 0x10, 0x00, 0x08, 0x00, 0x08, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x50, 0xCE, 0x19, 0xE7, 0x02, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x08, 0x00, 0x10, 0x03, 0x08, 0x1B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x00, 0x01, 0x08, 0x14, 0xE7, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x02, 0x08, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x10, 0x4B, 0xCE, 0x19, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x00, 0xFF, 0xFF, 0x03, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x08, 0x00, 0x00, 0x03, 0x10, 0x02, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x51, 0xCE, 0x45, 0xCE, 0x03, 0x00, 0x01, 0x10, 0x5D, 0xCE, 0x42, 0xCE, 0x19, 0xE7, 0xFF, 0xFF,
+        0x1F, 0xE7, 0x03, 0x08, 0x47, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x1B, 0xE7, 0x19, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x10, 0x00, 0x00, 0x03, 0x00, 0x03, 0x08, 0x1E, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x10, 0x03, 0x08, 0x4A, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x03, 0x00, 0x03, 0x08, 0x03, 0x00, 0x00, 0x08, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x46, 0xCE, 0x03, 0x08, 0x03, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x10, 0xE7, 0xFF, 0xFF, 0x00, 0x08, 0x5F, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x54, 0xCE, 0x02, 0x08, 0x03, 0x08, 0xFF, 0xFF, 0x02, 0x10, 0x5D, 0xCE, 0x01, 0x00, 0xFF, 0xFF,
+        0x00, 0x00, 0x01, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x10, 0x01, 0x08, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x10, 0x5C, 0xCE, 0x03, 0x10, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x00, 0xFF, 0xFF, 0x45, 0xCE, 0x55, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x16, 0xE7, 0x59, 0xCE, 0x4D, 0xCE, 0x00, 0x00, 0x1E, 0xE7, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x10, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x00, 0xFF, 0xFF, 0x01, 0x10, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x08, 0x03, 0x00, 0x02, 0x00, 0x50, 0xCE, 0xFF, 0xFF, 0x03, 0x00, 0x5D, 0xCE, 0xFF, 0xFF,
+        0x03, 0x00, 0x52, 0xCE, 0x01, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x1B, 0xE7, 0x00, 0x08, 0x47, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x02, 0x08, 0x1D, 0xE7, 0x01, 0x10, 0xFF, 0xFF, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x01, 0x10, 0x01, 0x00, 0x13, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x00, 0x02, 0x00, 0x00, 0x08, 0x1A, 0xE7, 0x5C, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x00, 0xFF, 0xFF, 0x03, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x02, 0x08, 0x02, 0x08, 0x17, 0xE7, 0x02, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x02, 0x08, 0x02, 0x10, 0x00, 0x10, 0x17, 0xE7, 0x16, 0xE7, 0x53, 0xCE, 0x03, 0x10, 0xFF, 0xFF,
+        0x02, 0x00, 0x16, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x54, 0xCE, 0x03, 0x08, 0x11, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x02, 0x08, 0xFF, 0xFF, 0x1E, 0xE7, 0x02, 0x08, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x10, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x10, 0xFF, 0xFF, 0x03, 0x08, 0x1B, 0xE7, 0x1B, 0xE7, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x02, 0x08, 0x00, 0x00, 0x02, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x02, 0x10, 0x43, 0xCE, 0x01, 0x10, 0x03, 0x08, 0x03, 0x10, 0x14, 0xE7, 0x03, 0x00, 0xFF, 0xFF,
+        0x00, 0x08, 0x18, 0xE7, 0x4C, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x02, 0x00, 0x01, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x10, 0xFF, 0xFF, 0x59, 0xCE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x08, 0x14, 0xE7, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x4F, 0xCE, 0x4C, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x10, 0x03, 0x08, 0x15, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x10, 0x01, 0x00, 0x49, 0xCE, 0x49, 0xCE, 0x10, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x15, 0xE7, 0x00, 0x00, 0x03, 0x00, 0x1D, 0xE7, 0x17, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x1A, 0xE7, 0x01, 0x00, 0x1B, 0xE7, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x14, 0xE7, 0x01, 0x00, 0x4D, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x02, 0x10, 0x58, 0xCE, 0x4A, 0xCE, 0xFF, 0xFF, 0x01, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x10, 0x02, 0x00, 0x59, 0xCE, 0x00, 0x08, 0xFF, 0xFF, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x10, 0x03, 0x10, 0x01, 0x10, 0x17, 0xE7, 0x11, 0xE7, 0x00, 0x10, 0xFF, 0xFF, 0x51, 0xCE,
+        0x42, 0xCE, 0x02, 0x10, 0x12, 0xE7, 0x00, 0x00, 0x02, 0x10, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x02, 0x10, 0x00, 0x10, 0xFF, 0xFF, 0x44, 0xCE, 0x00, 0x08, 0x00, 0x10, 0x16, 0xE7, 0x01, 0x10,
+        0x00, 0x08, 0xFF, 0xFF, 0x47, 0xCE, 0x00, 0x00, 0x02, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x08, 0x01, 0x08, 0x14, 0xE7, 0x15, 0xE7, 0xFF, 0xFF, 0x5A, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x00, 0xFF, 0xFF, 0x48, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x00, 0xFF, 0xFF, 0x00, 0x10, 0x01, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x10, 0x00, 0x08, 0x53, 0xCE, 0x4A, 0xCE, 0x02, 0x10, 0x01, 0x00, 0x00, 0x08, 0x02, 0x08,
+        0x11, 0xE7, 0xFF, 0xFF, 0x02, 0x00, 0x1F, 0xE7, 0xFF, 0xFF, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x00, 0x03, 0x08, 0x01, 0x08, 0xFF, 0xFF, 0x03, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0x00, 0x00,
+        0xFF, 0xFF, 0x02, 0x00, 0x03, 0x00, 0x43, 0xCE, 0x01, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x02, 0x08, 0x50, 0xCE, 0x02, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x18, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x50, 0xCE, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x02, 0x00, 0x01, 0x10, 0x00, 0x00, 0x14, 0xE7, 0x01, 0x00, 0x12, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x19, 0xE7, 0x00, 0x08, 0x00, 0x08, 0x03, 0x08, 0x1E, 0xE7, 0x1E, 0xE7, 0x00, 0x10, 0x4B, 0xCE,
+        0x01, 0x00, 0x00, 0x00, 0x1C, 0xE7, 0x4B, 0xCE, 0x01, 0x00, 0x02, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x08, 0x00, 0x08, 0x03, 0x00, 0x1A, 0xE7, 0x1D, 0xE7, 0x03, 0x08, 0x50, 0xCE, 0x1E, 0xE7,
+        0x02, 0x08, 0x4C, 0xCE, 0x00, 0x08, 0x14, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x08, 0x03, 0x08, 0x01, 0x10, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x08, 0x01, 0x08, 0x00, 0x08, 0xFF, 0xFF, 0x55, 0xCE, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0x42, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x4A, 0xCE, 0x01, 0x08, 0x03, 0x08, 0x5F, 0xCE, 0x01, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x4B, 0xCE, 0x03, 0x00, 0x1B, 0xE7, 0x01, 0x00, 0x02, 0x08, 0x02, 0x00, 0x00, 0x08, 0x42, 0xCE,
+        0x02, 0x00, 0x02, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x02, 0x10, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x00, 0xFF, 0xFF, 0x02, 0x08, 0x00, 0x08, 0x4D, 0xCE, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0x00,
+        0x02, 0x08, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x19, 0xE7, 0xFF, 0xFF, 0x1C, 0xE7, 0x47, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x01, 0x10, 0x1C, 0xE7, 0xFF, 0xFF, 0x03, 0x08, 0x56, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x4A, 0xCE, 0x03, 0x00, 0x1C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x15, 0xE7, 0x53, 0xCE, 0x03, 0x08, 0x02, 0x10, 0x03, 0x00, 0x5A, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x02, 0x10, 0x02, 0x08, 0x02, 0x00, 0x03, 0x10, 0x5C, 0xCE, 0x02, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x10, 0xFF, 0xFF, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x03, 0x08, 0x10, 0xE7,
+        0x00, 0x08, 0xFF, 0xFF, 0x1F, 0xE7, 0x02, 0x00, 0x16, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x15, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x00, 0x5D, 0xCE, 0x02, 0x10, 0x00, 0x08, 0x00, 0x00, 0x1D, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x11, 0xE7, 0x1B, 0xE7, 0x59, 0xCE, 0x03, 0x00, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x00, 0x02, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0xE7, 0x02, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x00, 0xFF, 0xFF, 0x02, 0x00, 0x01, 0x08, 0x45, 0xCE, 0x5E, 0xCE, 0x13, 0xE7, 0x50, 0xCE,
+        0x01, 0x08, 0x03, 0x10, 0x03, 0x08, 0x4E, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x1A, 0xE7, 0xFF, 0xFF, 0x02, 0x08, 0x1A, 0xE7, 0x11, 0xE7, 0x19, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x17, 0xE7, 0xFF, 0xFF, 0x03, 0x08, 0x1C, 0xE7, 0x1F, 0xE7, 0x03, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x1D, 0xE7, 0x02, 0x00, 0x02, 0x00, 0x5F, 0xCE, 0xFF, 0xFF, 0x11, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x13, 0xE7, 0x1C, 0xE7, 0x03, 0x08, 0x1E, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x4B, 0xCE, 0x03, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0x01, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x02, 0x00, 0x1D, 0xE7, 0x4D, 0xCE, 0x03, 0x10, 0x00, 0x10, 0x01, 0x00, 0x50, 0xCE,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0x16, 0xE7, 0x00, 0x00, 0x5E, 0xCE, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x01, 0x00, 0x02, 0x08, 0x00, 0x00, 0x4A, 0xCE, 0xFF, 0xFF, 0x02, 0x08, 0x01, 0x08,
+        0xFF, 0xFF, 0x01, 0x00, 0x01, 0x08, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x08, 0x55, 0xCE, 0x01, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x1E, 0xE7, 0x03, 0x10, 0xFF, 0xFF, 0x46, 0xCE, 0x02, 0x10, 0x4B, 0xCE, 0x03, 0x10, 0x44, 0xCE,
+        0x56, 0xCE, 0x02, 0x10, 0x01, 0x10, 0x01, 0x00, 0x44, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x08, 0xFF, 0xFF, 0x1B, 0xE7, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x03, 0x00, 0xFF, 0xFF, 0x03, 0x08, 0x01, 0x10, 0x00, 0x08, 0x01, 0x08, 0x1B, 0xE7,
+        0xFF, 0xFF, 0x11, 0xE7, 0x56, 0xCE, 0x03, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x10, 0x01, 0x10, 0x5A, 0xCE, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x08, 0xFF, 0xFF,
+        0x02, 0x00, 0x03, 0x00, 0x18, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x56, 0xCE, 0x1F, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x1A, 0xE7, 0x4C, 0xCE, 0x57, 0xCE, 0x03, 0x08, 0x1B, 0xE7, 0x01, 0x00, 0x03, 0x08, 0x03, 0x08,
+        0x19, 0xE7, 0x14, 0xE7, 0x01, 0x00, 0xFF, 0xFF, 0x03, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x03, 0x08, 0xFF, 0xFF, 0x1B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x5B, 0xCE, 0x1F, 0xE7, 0x01, 0x00, 0x5B, 0xCE, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x4D, 0xCE,
+        0x1F, 0xE7, 0x02, 0x10, 0x5D, 0xCE, 0x1A, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x00, 0x03, 0x08, 0x00, 0x00, 0x46, 0xCE, 0x4F, 0xCE, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00,
+        0xFF, 0xFF, 0x17, 0xE7, 0x51, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x00, 0x57, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x08, 0x01, 0x00, 0x00, 0x00, 0x50, 0xCE, 0x55, 0xCE, 0x03, 0x08, 0x1A, 0xE7, 0x01, 0x10,
+        0x00, 0x08, 0xFF, 0xFF, 0x00, 0x08, 0x1E, 0xE7, 0x47, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x08, 0x00, 0x08, 0x01, 0x08, 0x1E, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x08, 0x00, 0x00, 0xFF, 0xFF, 0x1B, 0xE7, 0xFF, 0xFF, 0x44, 0xCE, 0x1D, 0xE7, 0x01, 0x00,
+        0x5C, 0xCE, 0x02, 0x00, 0x03, 0x00, 0x19, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x08, 0x52, 0xCE, 0x12, 0xE7, 0x52, 0xCE, 0x03, 0x00, 0x17, 0xE7, 0x44, 0xCE, 0x16, 0xE7,
+        0x1A, 0xE7, 0x01, 0x00, 0x13, 0xE7, 0x02, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x02, 0x10, 0x49, 0xCE, 0x49, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x02, 0x10, 0x01, 0x00, 0x5F, 0xCE, 0x01, 0x00, 0x1B, 0xE7,
+        0x47, 0xCE, 0x02, 0x00, 0x1A, 0xE7, 0x46, 0xCE, 0x02, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x59, 0xCE, 0x01, 0x08, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x4B, 0xCE, 0x15, 0xE7, 0x02, 0x08, 0xFF, 0xFF, 0x02, 0x08, 0x03, 0x00, 0x45, 0xCE, 0x03, 0x08,
+        0x01, 0x08, 0x1B, 0xE7, 0x01, 0x00, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x10, 0xE7, 0x18, 0xE7, 0x03, 0x08, 0x5F, 0xCE, 0xFF, 0xFF, 0x12, 0xE7, 0x59, 0xCE, 0x50, 0xCE,
+        0x02, 0x00, 0x03, 0x08, 0x00, 0x00, 0x14, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x08, 0x00, 0x08, 0x02, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x17, 0xE7, 0x02, 0x00, 0x15, 0xE7, 0x19, 0xE7, 0x02, 0x10, 0x13, 0xE7, 0x01, 0x08, 0x17, 0xE7,
+        0x56, 0xCE, 0x44, 0xCE, 0x00, 0x08, 0x00, 0x00, 0x01, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x17, 0xE7, 0x5A, 0xCE, 0x58, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x13, 0xE7, 0x00, 0x08, 0xFF, 0xFF, 0x03, 0x10, 0x03, 0x00, 0x1E, 0xE7, 0x02, 0x10, 0x00, 0x08,
+        0x02, 0x08, 0xFF, 0xFF, 0x03, 0x08, 0x58, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x00, 0x00, 0x00, 0x01, 0x08, 0x03, 0x08, 0xFF, 0xFF, 0x17, 0xE7, 0x00, 0x08, 0xFF, 0xFF,
+        0x46, 0xCE, 0x02, 0x08, 0x1F, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x00, 0xFF, 0xFF, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x00, 0x08, 0x15, 0xE7, 0xFF, 0xFF, 0x15, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x00, 0xFF, 0xFF, 0x01, 0x08, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x00, 0x1D, 0xE7, 0x01, 0x10, 0x00, 0x00, 0x01, 0x08, 0x12, 0xE7, 0x01, 0x10, 0x11, 0xE7,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x51, 0xCE, 0x5E, 0xCE, 0x00, 0x10, 0x1A, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x02, 0x00, 0x56, 0xCE, 0x4E, 0xCE, 0x00, 0x10, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x08, 0x5B, 0xCE, 0x00, 0x08, 0xFF, 0xFF, 0x02, 0x00, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x02, 0x10, 0x00, 0x10, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x01, 0x10, 0x03, 0x10, 0x50, 0xCE, 0x5F, 0xCE, 0x00, 0x08, 0x46, 0xCE, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0x16, 0xE7, 0x13, 0xE7, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x03, 0x08, 0x02, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0xE7, 0x01, 0x00, 0x02, 0x08,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    }
+};
+
+#endif
@@ -0,0 +1,394 @@
+// Microbenchmarks for BinaryMatrix, Renderer draw calls and Font.
+//
+// Prints one line per benchmark: name, iterations and microseconds per operation (best of
+// BENCH_RUNS runs). With BENCH_COMPARE set to 1 every result is compared against baseline.h and
+// results slower than the baseline by more than BENCH_THRESHOLD are flagged as REGRESSION.
+// With BENCH_COMPARE set to 0 the results are printed as baseline.h entries instead.
+//
+// baseline.h is recorded with the host build (make bench in tools/host), which runs this sketch
+// against the panel emulator and exits with 1 on a regression. On a board the timings differ,
+// so the sketch prints entries to record by default; the panel must be connected, as the
+// Renderer waits for BUSY while it initializes the panel.
+
+#include <renderer.h>
+#include <binary_matrix.h>
+#include <box_font.h>
+#include <font.h>
+
+#include "baseline.h"
+
+#ifndef BENCH_COMPARE
+#define BENCH_COMPARE EINK_HOST
+#endif
+#ifndef BENCH_THRESHOLD
+#define BENCH_THRESHOLD 0.10f   // 10% slower than baseline
+#endif
+#define BENCH_RUNS 5
+#define BENCH_RETRIES 8         // measurements of a result over the threshold before it counts
+#define BENCH_MIN_MICROS 10000  // shortest run that is timed reliably
+
+typedef void (*BenchFunction)(int iterations);
+
+static int regressions = 0;
+#if BENCH_COMPARE
+static int improvements = 0;
+#endif
+
+// Benchmarked objects, used by the benchmark functions
+static BinaryMatrix *matrix = nullptr;
+static Renderer *renderer = nullptr;
+static BoxFont smallFont;
+static BoxFont largeFont;
+static Font *font = nullptr;
+static Image *image = nullptr;
+static uint8_t *imagePixels = nullptr;
+
+static const char *TEXT = "Temperature 21.5 C, AVWA";
+
+#if BENCH_COMPARE
+static float findBaseline(const char *name) {
+    for (const BenchBaseline &b : BENCH_BASELINE) {
+        if (strcmp(b.name, name) == 0) return b.micros;
+    }
+    return 0;
+}
+#endif
+
+// Fastest of BENCH_RUNS runs, in microseconds per iteration
+static float measureBest(BenchFunction fn, int iterations) {
+    float best = 0;
+    for (int run = 0; run < BENCH_RUNS; run++) {
+        uint32_t start = micros();
+        fn(iterations);
+        float perOp = (float) (micros() - start) / iterations;
+
+        if (run == 0 || perOp < best) best = perOp;
+        yield();
+    }
+    return best;
+}
+
+static void runBenchmark(const char *name, BenchFunction fn, int iterations) {
+    fn(1); // warm up
+
+    // The counts below suit the board; a faster machine needs more iterations per run
+    while (iterations < (1 << 24)) {
+        uint32_t start = micros();
+        fn(iterations);
+        uint32_t elapsed = micros() - start;
+        if (elapsed >= BENCH_MIN_MICROS) break;
+
+        iterations *= elapsed > 0 ? min(2 * BENCH_MIN_MICROS / elapsed, 100u) : 100;
+        yield();
+    }
+
+    float best = measureBest(fn, iterations);
+
+#if BENCH_COMPARE
+    float baseline = findBaseline(name);
+
+    // A shared machine has slow spells, so a result over the threshold is measured again first
+    for (int retry = 0; retry < BENCH_RETRIES && baseline > 0 && best > baseline * (1 + BENCH_THRESHOLD); retry++) {
+        best = min(best, measureBest(fn, iterations));
+    }
+
+    const char *verdict = "";
+    if (baseline > 0 && best > baseline * (1 + BENCH_THRESHOLD)) {
+        verdict = "REGRESSION";
+        regressions++;
+    } else if (baseline > 0 && best < baseline * (1 - BENCH_THRESHOLD)) {
+        verdict = "improved";
+        improvements++;
+    }
+    Serial.printf("%-36s %8d %12.4f us %12.4f us  %s\n", name, iterations, best, baseline, verdict);
+#else
+    Serial.printf("    { \"%s\", %.4f },\n", name, best);
+#endif
+}
+
+// BinaryMatrix
+
+static void benchSetPixel(int iterations) {
+    for (int i = 0; i < iterations; i++) {
+        matrix->setPixel((i * 7) % matrix->width, (i * 3) % matrix->height, i & 1);
+    }
+}
+
+static void benchGetPixel(int iterations) {
+    volatile bool sink = false;
+    for (int i = 0; i < iterations; i++) {
+        sink = matrix->getPixel((i * 7) % matrix->width, (i * 3) % matrix->height);
+    }
+    (void) sink;
+}
+
+static void benchSetRect(int iterations) {
+    // Unaligned quarter-screen rect, so both the partial and the full bytes are exercised
+    for (int i = 0; i < iterations; i++) {
+        matrix->setRect(3 + (i & 7), 5, matrix->width / 2, matrix->height / 2, i & 1);
+    }
+}
+
+static void benchClear(int iterations) {
+    for (int i = 0; i < iterations; i++) {
+        matrix->clear();
+    }
+}
+
+static void benchMatrix(int width, int height) {
+    char name[48];
+    matrix = new BinaryMatrix(width, height);
+
+    snprintf(name, sizeof(name), "matrix/setPixel/%dx%d", width, height);
+    runBenchmark(name, benchSetPixel, 10000);
+    snprintf(name, sizeof(name), "matrix/getPixel/%dx%d", width, height);
+    runBenchmark(name, benchGetPixel, 10000);
+    snprintf(name, sizeof(name), "matrix/setRect/%dx%d", width, height);
+    runBenchmark(name, benchSetRect, 20);
+    snprintf(name, sizeof(name), "matrix/clear/%dx%d", width, height);
+    runBenchmark(name, benchClear, 20);
+
+    delete matrix;
+    matrix = nullptr;
+}
+
+// Renderer
+
+static void benchDrawRect(int iterations) {
+    for (int i = 0; i < iterations; i++) renderer->drawRect(10 + (i & 7), 10, 300, 200);
+}
+
+static void benchFillRectSmall(int iterations) {
+    for (int i = 0; i < iterations; i++) renderer->fillRect(10 + (i & 7), 10, 20, 20);
+}
+
+static void benchFillRectLarge(int iterations) {
+    for (int i = 0; i < iterations; i++) renderer->fillRect(10 + (i & 7), 10, 600, 400);
+}
+
+static void benchFillRoundRect(int iterations) {
+    for (int i = 0; i < iterations; i++) renderer->fillRoundRect(100, 100, 200, 100, 20);
+}
+
+static void benchFillCircleSmall(int iterations) {
+    for (int i = 0; i < iterations; i++) renderer->fillCircle(200, 200, 10);
+}
+
+static void benchFillCircleLarge(int iterations) {
+    for (int i = 0; i < iterations; i++) renderer->fillCircle(300, 250, 100);
+}
+
+static void benchLineHorizontal(int iterations) {
+    for (int i = 0; i < iterations; i++) renderer->drawLine(10, 100, 800, 101);
+}
+
+static void benchLineDiagonal(int iterations) {
+    for (int i = 0; i < iterations; i++) renderer->drawLine(10, 10, 500, 500);
+}
+
+static void benchLineSteep(int iterations) {
+    for (int i = 0; i < iterations; i++) renderer->drawLine(300, 10, 320, 500);
+}
+
+static void benchFillPolygon(int iterations) {
+    static const Point star[] = { {300, 50}, {350, 200}, {500, 200}, {380, 290}, {430, 440}, {300, 350}, {170, 440}, {220, 290}, {100, 200}, {250, 200} };
+    for (int i = 0; i < iterations; i++) renderer->fillPolygon(star, 10);
+}
+
+static void benchFillArc(int iterations) {
+    for (int i = 0; i < iterations; i++) renderer->fillArc(440, 264, 150, 200, 135, 405);
+}
+
+static void benchDrawImage(int iterations) {
+    for (int i = 0; i < iterations; i++) renderer->drawImage(*image, 40, 40);
+}
+
+static BinaryMatrix *sprite = nullptr;
+
+static void benchBlitAligned(int iterations) {
+    for (int i = 0; i < iterations; i++) renderer->blit(*sprite, Rect(0, 0, sprite->width, sprite->height), 64, 64, ROP_OR);
+}
+
+static void benchBlitUnaligned(int iterations) {
+    for (int i = 0; i < iterations; i++) renderer->blit(*sprite, Rect(3, 0, sprite->width - 3, sprite->height), 67 + (i & 7), 64, ROP_OR);
+}
+
+static void benchScrollLeft(int iterations) {
+    // One sample of a rolling chart: shift left, draw the new column
+    for (int i = 0; i < iterations; i++) {
+        Rect exposed = renderer->scroll(Rect(40, 300, 800, 200), -1, 0);
+        renderer->fillRect(exposed.x, 400 + (i % 50), 1, 100 - (i % 50));
+    }
+}
+
+static void benchScrollUp(int iterations) {
+    for (int i = 0; i < iterations; i++) renderer->scroll(Rect(0, 0, 880, 528), 0, -16);
+}
+
+static void benchDrawText(int iterations) {
+    for (int i = 0; i < iterations; i++) renderer->drawText(20, 200, TEXT);
+}
+
+static void benchDrawTextCenter(int iterations) {
+    for (int i = 0; i < iterations; i++) renderer->drawText(440, 200, TEXT, TextAlignment::CENTER);
+}
+
+static void benchDrawTextRight(int iterations) {
+    for (int i = 0; i < iterations; i++) renderer->drawText(860, 200, TEXT, TextAlignment::RIGHT);
+}
+
+static void benchRenderer() {
+    renderer = new Renderer(880, 528);
+
+    runBenchmark("renderer/drawRect", benchDrawRect, 100);
+    runBenchmark("renderer/fillRect/small", benchFillRectSmall, 1000);
+    runBenchmark("renderer/fillRect/large", benchFillRectLarge, 20);
+    runBenchmark("renderer/fillRoundRect", benchFillRoundRect, 20);
+    runBenchmark("renderer/fillCircle/r10", benchFillCircleSmall, 200);
+    runBenchmark("renderer/fillCircle/r100", benchFillCircleLarge, 10);
+    runBenchmark("renderer/drawLine/horizontal", benchLineHorizontal, 100);
+    runBenchmark("renderer/drawLine/diagonal", benchLineDiagonal, 100);
+    runBenchmark("renderer/drawLine/steep", benchLineSteep, 100);
+    renderer->setFillPattern(FillPattern::gray(24));
+    runBenchmark("renderer/fillRect/large/gray", benchFillRectLarge, 20);
+    runBenchmark("renderer/fillCircle/r100/gray", benchFillCircleLarge, 10);
+    renderer->setFillPattern(FillPattern());
+    runBenchmark("renderer/fillPolygon", benchFillPolygon, 20);
+    runBenchmark("renderer/fillArc", benchFillArc, 20);
+
+    // 64x64 RGB565 checkerboard
+    const int size = 64;
+    imagePixels = (uint8_t*) malloc(size * size * 2);
+    for (int i = 0; i < size * size; i++) {
+        uint16_t color = ((i % size) / 4 + (i / size) / 4) % 2 ? 0xFFFF : 0x0000;
+        imagePixels[i * 2 + 0] = color & 0xFF;
+        imagePixels[i * 2 + 1] = color >> 8;
+    }
+    image = new Image(size, size, 2, imagePixels);
+
+    image->setScale(1);
+    runBenchmark("renderer/drawImage/x1", benchDrawImage, 20);
+    image->setScale(2);
+    runBenchmark("renderer/drawImage/x2", benchDrawImage, 10);
+    image->setScale(4);
+    runBenchmark("renderer/drawImage/x4", benchDrawImage, 5);
+
+    sprite = new BinaryMatrix(128, 128);
+    for (int y = 0; y < sprite->height; y++) sprite->fillSpan(y, y / 2, sprite->width - y / 2, true);
+    runBenchmark("renderer/blit/aligned", benchBlitAligned, 100);
+    runBenchmark("renderer/blit/unaligned", benchBlitUnaligned, 100);
+    runBenchmark("renderer/scroll/left", benchScrollLeft, 20);
+    runBenchmark("renderer/scroll/up", benchScrollUp, 20);
+    delete sprite;
+    sprite = nullptr;
+
+    Font small(*smallFont.image, smallFont.descriptor);
+    Font large(*largeFont.image, largeFont.descriptor);
+
+    renderer->setFont(&small);
+    runBenchmark("renderer/drawText/small/left", benchDrawText, 20);
+    runBenchmark("renderer/drawText/small/center", benchDrawTextCenter, 20);
+    runBenchmark("renderer/drawText/small/right", benchDrawTextRight, 20);
+
+    renderer->setFont(&large);
+    runBenchmark("renderer/drawText/large/left", benchDrawText, 10);
+    runBenchmark("renderer/drawText/large/center", benchDrawTextCenter, 10);
+    runBenchmark("renderer/drawText/large/right", benchDrawTextRight, 10);
+
+    small.setScale(2);
+    renderer->setFont(&small);
+    runBenchmark("renderer/drawText/small/x2", benchDrawText, 10);
+
+    small.setScale(1);
+    TextCache cache(16 * 1024);
+    renderer->setTextCache(&cache);
+    runBenchmark("renderer/drawText/small/cached", benchDrawText, 20);
+    renderer->setFont(&large);
+    runBenchmark("renderer/drawText/large/cached", benchDrawText, 10);
+    renderer->setTextCache(nullptr);
+
+    renderer->setFont(nullptr);
+    delete image;
+    free(imagePixels);
+    delete renderer;
+    renderer = nullptr;
+}
+
+// Font
+
+static void benchConstructSmall(int iterations) {
+    for (int i = 0; i < iterations; i++) {
+        Font f(*smallFont.image, smallFont.descriptor);
+    }
+}
+
+static void benchConstructLarge(int iterations) {
+    for (int i = 0; i < iterations; i++) {
+        Font f(*largeFont.image, largeFont.descriptor);
+    }
+}
+
+static void benchGetCharacter(int iterations) {
+    volatile int sink = 0;
+    for (int i = 0; i < iterations; i++) {
+        sink = font->getCharacter(32 + i % 95).xadvance;
+    }
+    (void) sink;
+}
+
+static void benchGetKerning(int iterations) {
+    volatile int sink = 0;
+    for (int i = 0; i < iterations; i++) {
+        sink = font->getKerning('A' + i % 26, 'A' + (i + 21) % 26);
+    }
+    (void) sink;
+}
+
+static void benchComputeWidth(int iterations) {
+    volatile int sink = 0;
+    for (int i = 0; i < iterations; i++) {
+        sink = font->computeWidth(TEXT);
+    }
+    (void) sink;
+}
+
+static void benchFont() {
+    runBenchmark("font/construct/small", benchConstructSmall, 10);
+    runBenchmark("font/construct/large", benchConstructLarge, 10);
+
+    font = new Font(*smallFont.image, smallFont.descriptor);
+    runBenchmark("font/getCharacter", benchGetCharacter, 10000);
+    runBenchmark("font/getKerning", benchGetKerning, 10000);
+    runBenchmark("font/computeWidth", benchComputeWidth, 1000);
+    delete font;
+    font = nullptr;
+}
+
+void setup() {
+    Serial.begin(115200);
+    delay(1000);
+
+    smallFont = makeBoxFont(8, 12);
+    largeFont = makeBoxFont(24, 32);
+
+#if BENCH_COMPARE
+    Serial.printf("%-36s %8s %15s %15s\n", "benchmark", "iters", "time/op", "baseline");
+#endif
+
+    benchMatrix(200, 200);
+    benchMatrix(400, 300);
+    benchMatrix(880, 528);
+    benchRenderer();
+    benchFont();
+
+#if BENCH_COMPARE
+    Serial.printf("\n%d regression(s), %d improvement(s) beyond %.0f%%\n", regressions, improvements, BENCH_THRESHOLD * 100);
+#endif
+
+#if EINK_HOST
+    exit(regressions > 0 ? 1 : 0);
+#endif
+}
+
+void loop() {
+}
@@ -0,0 +1,68 @@
+#ifndef bench_baseline_h
+#define bench_baseline_h
+
+/**
+ * Reference timings in microseconds per operation, as printed by the benchmark with
+ * BENCH_COMPARE set to 0. A time of 0 means no baseline has been recorded for that entry
+ * and it is reported without a verdict.
+ *
+ * Recorded on: host build (make bench BENCH_COMPARE=0 in tools/host), x86-64 virtual machine,
+ * g++ 12.2 -O2, median of 9 runs
+ */
+struct BenchBaseline {
+    const char *name;
+    float micros;
+};
+
+static const BenchBaseline BENCH_BASELINE[] = {
+    { "matrix/setPixel/200x200", 0.0082 },
+    { "matrix/setPixel/400x300", 0.0082 },
+    { "matrix/setPixel/880x528", 0.0083 },
+    { "matrix/getPixel/200x200", 0.0062 },
+    { "matrix/getPixel/400x300", 0.0067 },
+    { "matrix/getPixel/880x528", 0.0068 },
+    { "matrix/setRect/200x200", 1.670 },
+    { "matrix/setRect/400x300", 2.543 },
+    { "matrix/setRect/880x528", 4.787 },
+    { "matrix/clear/200x200", 0.0513 },
+    { "matrix/clear/400x300", 0.1267 },
+    { "matrix/clear/880x528", 1.603 },
+
+    { "renderer/drawRect", 4.219 },
+    { "renderer/fillRect/small", 0.3877 },
+    { "renderer/fillRect/large", 5.339 },
+    { "renderer/fillRoundRect", 2.359 },
+    { "renderer/fillCircle/r10", 0.4506 },
+    { "renderer/fillCircle/r100", 4.314 },
+    { "renderer/drawLine/horizontal", 7.115 },
+    { "renderer/drawLine/diagonal", 9.320 },
+    { "renderer/drawLine/steep", 4.949 },
+    { "renderer/fillRect/large/gray", 37.005 },
+    { "renderer/fillCircle/r100/gray", 7.021 },
+    { "renderer/fillPolygon", 16.156 },
+    { "renderer/fillArc", 23.668 },
+    { "renderer/drawImage/x1", 42.331 },
+    { "renderer/drawImage/x2", 216.7 },
+    { "renderer/drawImage/x4", 856.7 },
+    { "renderer/blit/aligned", 4.047 },
+    { "renderer/blit/unaligned", 5.013 },
+    { "renderer/scroll/left", 42.932 },
+    { "renderer/scroll/up", 24.604 },
+    { "renderer/drawText/small/left", 21.684 },
+    { "renderer/drawText/small/center", 21.078 },
+    { "renderer/drawText/small/right", 21.106 },
+    { "renderer/drawText/large/left", 124.3 },
+    { "renderer/drawText/large/center", 128.4 },
+    { "renderer/drawText/large/right", 122.9 },
+    { "renderer/drawText/small/x2", 98.135 },
+    { "renderer/drawText/small/cached", 0.6441 },
+    { "renderer/drawText/large/cached", 2.557 },
+
+    { "font/construct/small", 5.568 },
+    { "font/construct/large", 5.635 },
+    { "font/getCharacter", 0.0146 },
+    { "font/getKerning", 0.0219 },
+    { "font/computeWidth", 0.3526 },
+};
+
+#endif
@@ -0,0 +1,80 @@
+// Several FreeRTOS tasks draw on one panel without a mutex. Each task pushes self-contained draw
+// commands into a DrawQueue and goes on; the render task drains the queue in batches and
+// refreshes the panel when the previous refresh is done.
+
+#include <box_font.h>
+#include <draw_queue.h>
+#include <renderer.h>
+
+static Renderer *renderer = nullptr;
+static DrawQueue queue(64);
+static Font *font = nullptr;
+
+static void push(const DrawCommand &command) {
+    // The queue only fills up if the render task falls behind; drop the command then
+    if (!queue.push(command)) {
+        Serial.println("draw queue full");
+    }
+}
+
+static void clockTask(void *) {
+    for (uint32_t seconds = 0; ; seconds++) {
+        char text[16];
+        snprintf(text, sizeof(text), "%02lu:%02lu", (unsigned long) (seconds / 60) % 60, (unsigned long) seconds % 60);
+
+        DrawCommand clear = DrawCommand::fillRect(20, 20, 200, 40);
+        clear.clear = true;
+        push(clear);
+        push(DrawCommand::drawText(20, 20, text, font));
+
+        vTaskDelay(pdMS_TO_TICKS(1000));
+    }
+}
+
+static void sensorTask(void *) {
+    for (int i = 0; ; i++) {
+        const int level = 100 + 80 * sin(i * 0.3f);
+
+        DrawCommand clear = DrawCommand::fillRect(300, 20, 40, 200);
+        clear.clear = true;
+        push(clear);
+
+        DrawCommand bar = DrawCommand::fillRect(300, 220 - level, 40, level);
+        bar.color = DisplayColor::RED;
+        bar.pattern = FillPattern::gray(48);
+        push(bar);
+
+        vTaskDelay(pdMS_TO_TICKS(700));
+    }
+}
+
+static void renderTask(void *) {
+    while (true) {
+        renderer->drain(queue);
+
+        if (renderer->isDirty() && !renderer->isBusy()) {
+            renderer->renderAsync();
+        }
+        vTaskDelay(pdMS_TO_TICKS(20));
+    }
+}
+
+void setup() {
+    Serial.begin(115200);
+
+    BoxFont box = makeBoxFont(12, 16);
+    font = new Font(*box.image, box.descriptor);
+
+    renderer = new Renderer(880, 528);
+    renderer->setPartialTransfer(true);
+    renderer->begin();
+    renderer->clearAll();
+
+    xTaskCreate(renderTask, "render", 8192, nullptr, 2, nullptr);
+    xTaskCreate(clockTask, "clock", 4096, nullptr, 1, nullptr);
+    xTaskCreate(sensorTask, "sensor", 4096, nullptr, 1, nullptr);
+}
+
+void loop() {
+    vTaskDelay(portMAX_DELAY);
+}
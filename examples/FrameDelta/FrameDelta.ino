@@ -0,0 +1,56 @@
+// Shows screens composed on a server. The server (tools/delta/delta_server.cpp stands in for it)
+// sends a keyframe when the device connects and then only the changed rects of each frame, which
+// are applied to the planes as they arrive and refreshed with a partial transfer.
+
+#include <WiFi.h>
+
+#include <renderer.h>
+
+#define WIFI_SSID "your-ssid"
+#define WIFI_PASSWORD "your-password"
+#define SERVER_HOST "192.168.1.10"
+#define SERVER_PORT 5000
+
+static Renderer *renderer = nullptr;
+static DeltaDecoder decoder;
+static WiFiClient client;
+
+void setup() {
+    Serial.begin(115200);
+
+    WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
+    while (WiFi.status() != WL_CONNECTED) {
+        delay(250);
+    }
+
+    renderer = new Renderer(880, 528);
+    renderer->setPartialTransfer(true);
+    renderer->begin();
+}
+
+void loop() {
+    if (!client.connected()) {
+        // The server starts every connection with a keyframe
+        decoder.reset();
+        if (!client.connect(SERVER_HOST, SERVER_PORT)) {
+            delay(5000);
+            return;
+        }
+    }
+
+    if (client.available() == 0) {
+        delay(50);
+        return;
+    }
+
+    StreamSource source(client);
+    DeltaStats stats;
+    if (!renderer->applyDelta(decoder, source, &stats)) {
+        if (!decoder.isSynced()) client.stop();
+        return;
+    }
+
+    Serial.printf("frame %u: %lu bytes, %u rects, %lu pixels, decoded in %lu us\n", decoder.sequence(),
+        (unsigned long) stats.bytes, stats.rects, (unsigned long) stats.pixels, (unsigned long) stats.micros);
+    renderer->render();
+}
@@ -0,0 +1,37 @@
+// Three panels on one SPI bus. Each panel has its own CS, DC, BUSY and RESET pins; SCK and MOSI
+// are shared. DisplayGroup sends a frame to one panel while the others refresh, so an update of
+// all three takes about as long as a single refresh.
+//
+// Dense planes would take 3 x 116 KB, more than the heap of an ESP32 without PSRAM, so the
+// panels use sparse planes: only the rows under the circles take memory. Full-screen content on
+// three panels needs a board with PSRAM.
+
+#include <display_group.h>
+#include <renderer.h>
+
+static DisplayGroup panels;
+
+void setup() {
+    Serial.begin(115200);
+
+    // Constructed here rather than as globals, since a Renderer sets up its panel when it is
+    // constructed and that needs the Arduino core to be running
+    // width, height, cs, dc, busy, reset
+    panels.add(new Renderer(EInkConfig(880, 528, 26, 25, 33, 32), ROTATE_0, false, true));
+    panels.add(new Renderer(EInkConfig(880, 528, 15, 4, 34, 14), ROTATE_0, false, true));
+    panels.add(new Renderer(EInkConfig(880, 528, 5, 17, 35, 16), ROTATE_0, false, true));
+}
+
+void loop() {
+    for (int i = 0; i < panels.size(); i++) {
+        Renderer &panel = panels[i];
+        panel.clearAll();
+        panel.setColor(i == 1 ? DisplayColor::RED : DisplayColor::BLACK);
+        panel.fillCircle(440, 264, 50 + random(0, 120));
+    }
+
+    panels.update();
+    Serial.printf("updated %d panels in %u ms\n", panels.size(), panels.lastUpdateMicros() / 1000);
+
+    delay(60000);
+}
@@ -0,0 +1,99 @@
+// Keeps the frame across deep sleep in a compressed snapshot instead of redrawing it on wake.
+//
+// The snapshot is stored in RTC memory when it fits, otherwise in a LittleFS file. Every wake
+// restores it, prints the compression ratio and the restore time, and only draws what changed.
+
+#include <LittleFS.h>
+#include <esp_sleep.h>
+
+#include <renderer.h>
+
+#define SLEEP_SECONDS 60
+#define SNAPSHOT_PATH "/frame.snp"
+
+RTC_DATA_ATTR static uint8_t rtcSnapshot[6 * 1024];
+RTC_DATA_ATTR static uint32_t rtcSnapshotSize = 0;
+RTC_DATA_ATTR static uint32_t wakeCount = 0;
+
+static void drawBackground(Renderer &renderer) {
+    renderer.clearAll();
+
+    renderer.setColor(DisplayColor::BLACK);
+    renderer.fillRect(0, 0, renderer.getWidth(), 40);
+    renderer.drawRect(20, 60, renderer.getWidth() - 40, renderer.getHeight() - 80);
+
+    renderer.setColor(DisplayColor::RED);
+    renderer.fillCircle(renderer.getWidth() - 80, 120, 30);
+}
+
+static bool restore(Renderer &renderer) {
+    SnapshotStats stats;
+    bool restored = false;
+
+    if (rtcSnapshotSize > 0) {
+        MemorySource source(rtcSnapshot, rtcSnapshotSize);
+        restored = renderer.restoreSnapshot(source, &stats);
+    } else {
+        File file = LittleFS.open(SNAPSHOT_PATH, "r");
+        if (file) {
+            StreamSource source(file);
+            restored = renderer.restoreSnapshot(source, &stats);
+            file.close();
+        }
+    }
+
+    if (restored) {
+        Serial.printf("restored %u bytes from %u (%.1fx) in %u us\n", stats.rawBytes, stats.encodedBytes,
+            (float) stats.rawBytes / stats.encodedBytes, stats.micros);
+    }
+    return restored;
+}
+
+static void save(Renderer &renderer) {
+    SnapshotStats stats;
+
+    MemorySink memory(rtcSnapshot, sizeof(rtcSnapshot));
+    if (renderer.saveSnapshot(memory, &stats)) {
+        rtcSnapshotSize = memory.size();
+    } else {
+        // Too large for RTC memory
+        rtcSnapshotSize = 0;
+        File file = LittleFS.open(SNAPSHOT_PATH, "w");
+        StreamSink sink(file);
+        renderer.saveSnapshot(sink, &stats);
+        file.close();
+    }
+
+    Serial.printf("saved %u bytes as %u (%.1fx) in %u us, %s\n", stats.rawBytes, stats.encodedBytes,
+        (float) stats.rawBytes / stats.encodedBytes, stats.micros, rtcSnapshotSize > 0 ? "RTC memory" : "LittleFS");
+}
+
+void setup() {
+    Serial.begin(115200);
+    LittleFS.begin(true);
+
+    Renderer renderer(880, 528);
+    renderer.setPartialTransfer(true);
+    renderer.begin();
+
+    const bool woke = esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TIMER;
+    if (!woke || !restore(renderer)) {
+        drawBackground(renderer);
+    }
+
+    // Only the counter changes between wakes
+    renderer.setColor(DisplayColor::BLACK);
+    renderer.setClearMode();
+    renderer.fillRect(40, 80, 200, 20);
+    renderer.setDrawMode();
+    renderer.fillRect(40, 80, 10 + (wakeCount++ % 19) * 10, 20);
+
+    renderer.render();
+    save(renderer);
+
+    renderer.end();
+    esp_deep_sleep(SLEEP_SECONDS * 1000000ULL);
+}
+
+void loop() {
+}
@@ -0,0 +1,46 @@
+// Downloads an image and draws it while it arrives, without buffering the file. PBM, PGM, BMP and
+// RLE images are decoded one row at a time straight into the black plane; gray images are
+// dithered.
+
+#include <HTTPClient.h>
+#include <WiFi.h>
+
+#include <renderer.h>
+
+#define WIFI_SSID "your-ssid"
+#define WIFI_PASSWORD "your-password"
+#define IMAGE_URL "http://example.com/weather-map.pgm"
+
+void setup() {
+    Serial.begin(115200);
+
+    WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
+    while (WiFi.status() != WL_CONNECTED) {
+        delay(250);
+    }
+
+    Renderer renderer(880, 528);
+    renderer.begin();
+    renderer.clearAll();
+
+    HTTPClient http;
+    http.begin(IMAGE_URL);
+    const int status = http.GET();
+    if (status != HTTP_CODE_OK) {
+        Serial.printf("Error: HTTP status %d\n", status);
+        return;
+    }
+
+    const uint32_t start = millis();
+    StreamSource source(*http.getStreamPtr());
+    renderer.setColor(DisplayColor::BLACK);
+    const bool ok = renderer.drawImage(source, 0, 0, DITHER_DIFFUSION);
+    Serial.printf("%s in %lu ms (download and decode)\n", ok ? "decoded" : "failed", (unsigned long) (millis() - start));
+    http.end();
+
+    renderer.render();
+    renderer.end();
+}
+
+void loop() {
+}
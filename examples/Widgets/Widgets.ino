@@ -0,0 +1,50 @@
+// Dashboard built from retained widgets. Every update only redraws the widgets whose value
+// changed, and only their rects are sent to the panel.
+
+#include <box_font.h>
+#include <renderer.h>
+#include <widget.h>
+
+static Renderer *renderer = nullptr;
+static Font *font = nullptr;
+
+static Container *screen = nullptr;
+static Label *title = nullptr;
+static ValueField *temperature = nullptr;
+static ValueField *humidity = nullptr;
+static ProgressBar *battery = nullptr;
+
+void setup() {
+    Serial.begin(115200);
+
+    BoxFont box = makeBoxFont(12, 16);
+    font = new Font(*box.image, box.descriptor);
+
+    renderer = new Renderer(880, 528);
+    renderer->setPartialTransfer(true);
+
+    screen = new Container(Rect(0, 0, 880, 528), 2);
+    title = new Label(Rect(20, 20, 840, 24), font, "Greenhouse", TextAlignment::CENTER);
+    temperature = new ValueField(Rect(20, 80, 300, 24), font, 1, " C", TextAlignment::LEFT);
+    humidity = new ValueField(Rect(20, 120, 300, 24), font, 0, " %", TextAlignment::LEFT);
+    battery = new ProgressBar(Rect(20, 480, 840, 24), DisplayColor::RED, FillPattern::gray(40));
+
+    screen->add(title);
+    screen->add(temperature);
+    screen->add(humidity);
+    screen->add(battery);
+
+    renderer->clearAll();
+}
+
+void loop() {
+    temperature->setValue(20 + random(0, 50) / 10.0f);
+    humidity->setValue(random(40, 60));
+    battery->setValue(random(0, 100) / 100.0f);
+
+    screen->update(*renderer);
+    Serial.printf("%d dirty rect(s), %u pixels\n", renderer->getDirtyRegion().count(), renderer->getDirtyRegion().area());
+    renderer->render();
+
+    delay(60000);
+}
@@ -0,0 +1,70 @@
+#include "fill_pattern.h"
+
+#include <pgmspace.h>
+
+// Threshold of each pixel of an 8x8 tile, spreading every gray level evenly over the tile
+static constexpr uint8_t BAYER_8X8[64] PROGMEM = {
+     0, 32,  8, 40,  2, 34, 10, 42,
+    48, 16, 56, 24, 50, 18, 58, 26,
+    12, 44,  4, 36, 14, 46,  6, 38,
+    60, 28, 52, 20, 62, 30, 54, 22,
+     3, 35, 11, 43,  1, 33,  9, 41,
+    51, 19, 59, 27, 49, 17, 57, 25,
+    15, 47,  7, 39, 13, 45,  5, 37,
+    63, 31, 55, 23, 61, 29, 53, 21,
+};
+
+const int FillPattern::GRAY_LEVELS;
+
+FillPattern::FillPattern() {
+    memset(rows, 0xFF, sizeof(rows));
+}
+
+FillPattern::FillPattern(const uint8_t rows[8]) {
+    memcpy(this->rows, rows, sizeof(this->rows));
+}
+
+FillPattern FillPattern::gray(int level) {
+    FillPattern pattern;
+
+    for (int y = 0; y < 8; y++) {
+        uint8_t word = 0;
+        for (int x = 0; x < 8; x++) {
+            if (pgm_read_byte(BAYER_8X8 + y * 8 + x) < level) word |= 0x80 >> x;
+        }
+        pattern.rows[y] = word;
+    }
+    return pattern;
+}
+
+uint8_t FillPattern::bayer(int x, int y) {
+    return pgm_read_byte(BAYER_8X8 + (y & 7) * 8 + (x & 7));
+}
+
+FillPattern FillPattern::hatch(Hatch style) {
+    FillPattern pattern;
+
+    for (int y = 0; y < 8; y++) {
+        const uint8_t horizontal = y == 0 ? 0xFF : 0x00;
+        const uint8_t vertical = 0x80;
+        const uint8_t diagonal = 0x01 << y;
+        const uint8_t antiDiagonal = 0x80 >> y;
+
+        switch (style) {
+            case HATCH_HORIZONTAL: pattern.rows[y] = horizontal; break;
+            case HATCH_VERTICAL: pattern.rows[y] = vertical; break;
+            case HATCH_DIAGONAL: pattern.rows[y] = diagonal; break;
+            case HATCH_ANTI_DIAGONAL: pattern.rows[y] = antiDiagonal; break;
+            case HATCH_CROSS: pattern.rows[y] = horizontal | vertical; break;
+            case HATCH_DIAGONAL_CROSS: pattern.rows[y] = diagonal | antiDiagonal; break;
+        }
+    }
+    return pattern;
+}
+
+bool FillPattern::isSolid() const {
+    for (uint8_t row : rows) {
+        if (row != 0xFF) return false;
+    }
+    return true;
+}
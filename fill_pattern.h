@@ -0,0 +1,44 @@
+#ifndef fill_pattern_h
+#define fill_pattern_h
+
+#include <Arduino.h>
+
+enum Hatch : uint8_t {
+    HATCH_HORIZONTAL,
+    HATCH_VERTICAL,
+    HATCH_DIAGONAL,         // rising to the right: /
+    HATCH_ANTI_DIAGONAL,    // falling to the right: \ (backslash)
+    HATCH_CROSS,
+    HATCH_DIAGONAL_CROSS,
+};
+
+/**
+ * 8x8 pattern for filled shapes, as 8 row words with the leftmost pixel in the MSB. Patterns are
+ * anchored to the screen (pixel x, y uses bit 7 - x % 8 of row y % 8), so a row of a pattern
+ * is one byte that lines up with the bytes of a BinaryMatrix row and is combined with the span
+ * mask as is.
+ */
+struct FillPattern {
+    uint8_t rows[8];
+
+    // Every pixel set
+    FillPattern();
+    FillPattern(const uint8_t rows[8]);
+
+    // Ordered dither of an 8x8 Bayer matrix, level 0 (no pixel set) to GRAY_LEVELS (all set)
+    static const int GRAY_LEVELS = 64;
+    static FillPattern gray(int level);
+    // Threshold of pixel x, y in the Bayer matrix: the pixel is set in gray(level) if it is below level
+    static uint8_t bayer(int x, int y);
+
+    // Lines 8 pixels apart
+    static FillPattern hatch(Hatch style);
+
+    inline uint8_t row(int y) const {
+        return rows[y & 7];
+    }
+
+    bool isSolid() const;
+};
+
+#endif
@@ -16,21 +16,57 @@ Font::Font(Image image, const unsigned char *descriptor) : fontImage(image) {
     offset = parseBlock(descriptor, offset, 5);
 }
 
+Font::Font(const CompiledFont &font) : fontImage(Image::fromBitmap(font.sheet)), compiled(&font) {
+    fontInfo = FontInfo();
+    fontCommon = FontCommon();
+    fontCommon.lineHeight = font.lineHeight;
+    fontCommon.base = font.base;
+    fontCommon.scaleW = font.sheet.width;
+    fontCommon.scaleH = font.sheet.height;
+    fontCommon.pages = 1;
+}
+
 void Font::setScale(float scale) {
     this->scale = scale;
     fontImage.setScale(scale);
 }
 
+float Font::getScale() const {
+    return scale;
+}
+
 FontChar Font::getCharacter(char ch) const {
-    if (characters.find(ch) == characters.end()) {
-        Serial.println("Character not found: " + ch);
-        return FontChar();
+    FontChar fc;
+
+    if (compiled != nullptr) {
+        const CompiledGlyph *glyph = findGlyph(ch);
+        if (glyph == nullptr) {
+            Serial.printf("Character not found: %c\n", ch);
+            return FontChar();
+        }
+
+        fc.id = glyph->id;
+        fc.x = glyph->x;
+        fc.y = glyph->y;
+        fc.width = glyph->width;
+        fc.height = glyph->height;
+        fc.xoffset = glyph->xoffset;
+        fc.yoffset = glyph->yoffset;
+        fc.xadvance = glyph->xadvance;
+        fc.page = 0;
+        fc.chnl = 15;
+    } else {
+        if (characters.find(ch) == characters.end()) {
+            Serial.printf("Character not found: %c\n", ch);
+            return FontChar();
+        }
+
+        fc = characters.at(ch);
     }
 
-    if (this->scale == 1.0f) return characters.at(ch);
+    if (this->scale == 1.0f) return fc;
 
     // We have to manipulate the character with the new scaling
-    FontChar fc = characters.at(ch);
     fc.x *= scale;
     fc.y *= scale;
     fc.width *= scale;
@@ -43,6 +79,11 @@ FontChar Font::getCharacter(char ch) const {
 }
 
 int16_t Font::getKerning(char first, char second) const {
+    if (compiled != nullptr) {
+        const CompiledKerning *pair = findKerning(first, second);
+        return pair != nullptr ? pair->amount * scale : 0;
+    }
+
     if (kerning.find( (IntPair) {first, second} ) == kerning.end()) {
         return 0;
     }
@@ -188,3 +229,33 @@ bool Font::verifyDescriptorSignature(const unsigned char *descriptor) {
     if (pgm_read_byte(descriptor + 3) != 3) return false;
     return true;
 }
+
+const CompiledGlyph *Font::findGlyph(uint32_t id) const {
+    int lo = 0;
+    int hi = compiled->glyphCount - 1;
+
+    while (lo <= hi) {
+        const int mid = (lo + hi) / 2;
+        const CompiledGlyph *glyph = &compiled->glyphs[mid];
+        if (glyph->id == id) return glyph;
+        if (glyph->id < id) lo = mid + 1;
+        else hi = mid - 1;
+    }
+
+    return nullptr;
+}
+
+const CompiledKerning *Font::findKerning(uint32_t first, uint32_t second) const {
+    int lo = 0;
+    int hi = compiled->kerningCount - 1;
+
+    while (lo <= hi) {
+        const int mid = (lo + hi) / 2;
+        const CompiledKerning *pair = &compiled->kerning[mid];
+        if (pair->first == first && pair->second == second) return pair;
+        if (pair->first < first || (pair->first == first && pair->second < second)) lo = mid + 1;
+        else hi = mid - 1;
+    }
+
+    return nullptr;
+}
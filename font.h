@@ -4,6 +4,7 @@
 #include <Arduino.h>
 #include <unordered_map>
 
+#include "compiled_asset.h"
 #include "image.h"
 
 struct FontInfo {
@@ -75,10 +76,12 @@ class Font {
     std::unordered_map<uint32_t, FontChar> characters;
     std::unordered_map<IntPair, int16_t, IntHash> kerning;
 
-
     Image fontImage;
     float scale = 1.0f;
 
+    // Set for fonts generated by tools/asset_compiler.py, which are looked up in place
+    const CompiledFont *compiled = nullptr;
+
 public:
     /**
      * Creates a font class with the specified data.
@@ -87,7 +90,14 @@ public:
      */
     Font(Image image, const unsigned char *descriptor);
 
+    /**
+     * Creates a font from a header generated by tools/asset_compiler.py. The font keeps a pointer
+     * to the tables, which are normally constexpr.
+     */
+    Font(const CompiledFont &font);
+
     void setScale(float scale);
+    float getScale() const;
 
     FontChar getCharacter(char ch) const;
     int16_t getKerning(char first, char second) const;
@@ -110,6 +120,11 @@ private:
     void parseBlock4(const unsigned char *descriptor, int offset, int size);
     void parseBlock5(const unsigned char *descriptor, int offset, int size);
     bool verifyDescriptorSignature(const unsigned char *descriptor);
+
+    // Lookups in a compiled font
+
+    const CompiledGlyph *findGlyph(uint32_t id) const;
+    const CompiledKerning *findKerning(uint32_t first, uint32_t second) const;
 };
 
 #endif
@@ -0,0 +1,142 @@
+#include "frame_delta.h"
+
+#include "row_codec.h"
+
+static const uint8_t DELTA_MAGIC[4] = { 'E', 'D', 'L', 'T' };
+
+static uint16_t getWord(const uint8_t *p) {
+    return p[0] | (p[1] << 8);
+}
+
+static uint32_t getDword(const uint8_t *p) {
+    return getWord(p) | ((uint32_t) getWord(p + 2) << 16);
+}
+
+static bool skipBytes(ByteSource &source, uint32_t length) {
+    uint8_t scratch[32];
+    while (length > 0) {
+        const uint32_t n = min(length, (uint32_t) sizeof(scratch));
+        if (!source.read(scratch, n)) return false;
+        length -= n;
+    }
+    return true;
+}
+
+bool DeltaDecoder::apply(BinaryMatrix &black, BinaryMatrix &red, ByteSource &source, DirtyRegion *touched,
+        DeltaStats *stats) {
+    const uint32_t start = micros();
+
+    CountingSource counted(source);
+    DeltaStats local = { 0, 0, 0, 0 };
+
+    uint8_t header[DELTA_HEADER_BYTES];
+    if (!counted.read(header, sizeof(header))) {
+        Serial.println("Error: delta header could not be read");
+        return false;
+    }
+
+    if (memcmp(header, DELTA_MAGIC, sizeof(DELTA_MAGIC)) != 0 || header[4] != DELTA_VERSION) {
+        // Without a valid header the payload size is unknown, so the stream can't be resynced
+        Serial.println("Error: not a frame delta");
+        _synced = false;
+        return false;
+    }
+
+    const bool keyframe = header[5] & DELTA_KEYFRAME;
+    const uint16_t width = getWord(header + 6);
+    const uint16_t height = getWord(header + 8);
+    const uint16_t base = getWord(header + 10);
+    const uint16_t sequence = getWord(header + 12);
+    const uint16_t count = getWord(header + 14);
+    const uint32_t payload = getDword(header + 16);
+
+    bool applicable = true;
+    if (width != black.width || height != black.height || width != red.width || height != red.height) {
+        Serial.printf("Error: delta is of size (%d,%d), screen size is (%d,%d)\n", width, height, black.width, black.height);
+        applicable = false;
+    } else if (!keyframe && (!_synced || base != _sequence)) {
+        Serial.printf("Error: delta is for frame %u, screen shows %s%u\n", base, _synced ? "" : "unknown, last ", _sequence);
+        applicable = false;
+    }
+
+    if (!applicable) {
+        skipBytes(counted, payload);
+        return false;
+    }
+
+    const bool ok = applyRecords(black, red, counted, count, touched, &local);
+    _synced = ok;
+    if (ok) _sequence = sequence;
+
+    local.bytes = counted.count;
+    local.micros = micros() - start;
+    if (stats != nullptr) *stats = local;
+    return ok;
+}
+
+bool DeltaDecoder::isSynced() const {
+    return _synced;
+}
+
+uint16_t DeltaDecoder::sequence() const {
+    return _sequence;
+}
+
+void DeltaDecoder::reset() {
+    _synced = false;
+}
+
+bool DeltaDecoder::applyRecords(BinaryMatrix &black, BinaryMatrix &red, ByteSource &source, int count,
+        DirtyRegion *touched, DeltaStats *stats) {
+    // One row of a rect is at most a plane row
+    uint8_t *row = (uint8_t*) malloc(black.stride);
+    if (row == nullptr) {
+        Serial.println("Error: not enough memory to apply the delta");
+        return false;
+    }
+
+    bool ok = true;
+    for (int r = 0; r < count && ok; r++) {
+        uint8_t record[DELTA_RECORD_BYTES];
+        if (!source.read(record, sizeof(record))) {
+            ok = false;
+            break;
+        }
+
+        const uint8_t plane = record[0];
+        const uint8_t mode = record[1];
+        const Rect rect(getWord(record + 2), getWord(record + 4), getWord(record + 6), getWord(record + 8));
+
+        if (plane > DELTA_PLANE_RED || mode > DELTA_XOR || rect.isEmpty()
+                || rect.x + rect.width > black.width || rect.y + rect.height > black.height) {
+            Serial.println("Error: invalid delta record");
+            ok = false;
+            break;
+        }
+
+        BinaryMatrix &target = plane == DELTA_PLANE_BLACK ? black : red;
+        const int rowBytes = (rect.width + 7) / 8;
+
+        // Marked before writing, so a delta that fails part way still gets refreshed
+        if (touched != nullptr) touched->add(rect);
+        stats->rects++;
+        stats->pixels += rect.area();
+
+        if (mode == DELTA_FILL) {
+            uint8_t value;
+            ok = source.read(&value, 1);
+            if (ok) target.setRect(rect.x, rect.y, rect.width, rect.height, value != 0);
+            continue;
+        }
+
+        const RasterOp rop = mode == DELTA_XOR ? ROP_XOR : ROP_COPY;
+        for (int y = rect.y; y < rect.y + rect.height && ok; y++) {
+            ok = decodeRleRow(source, row, rowBytes);
+            if (ok) blitRow(row, rowBytes, 0, target.rowData(y), rect.x, rect.width, rop);
+        }
+    }
+
+    free(row);
+    if (!ok) Serial.println("Error: delta is truncated or corrupt");
+    return ok;
+}
@@ -0,0 +1,75 @@
+#ifndef frame_delta_h
+#define frame_delta_h
+
+#include <Arduino.h>
+
+#include "binary_matrix.h"
+#include "byte_stream.h"
+#include "dirty_region.h"
+
+/**
+ * Frame deltas: changes to the black and red planes composed elsewhere (e.g. on a server) and
+ * applied in place. tools/delta/delta_encoder.h produces them on the host.
+ *
+ * A delta is a 20 byte header followed by rect records, all little endian:
+ *
+ *   header  "EDLT", version, flags, width u16, height u16, base u16, sequence u16,
+ *           rect count u16, payload bytes u32 (size of the records)
+ *   record  plane u8, mode u8, x u16, y u16, width u16, height u16, then
+ *           DELTA_FILL:    the fill byte (0x00 or 0xFF)
+ *           DELTA_REPLACE: height rows of the new pixels
+ *           DELTA_XOR:     height rows XORed into the plane
+ *
+ * Rows are (width + 7) / 8 bytes, starting at pixel x, coded as in row_codec.h. A delta applies
+ * to the frame numbered base and results in the frame numbered sequence; a keyframe (DELTA_KEYFRAME
+ * flag) replaces every pixel and applies to any frame.
+ */
+enum DeltaPlane : uint8_t {
+    DELTA_PLANE_BLACK,
+    DELTA_PLANE_RED,
+};
+
+enum DeltaMode : uint8_t {
+    DELTA_FILL,
+    DELTA_REPLACE,
+    DELTA_XOR,
+};
+
+static const uint8_t DELTA_VERSION = 1;
+static const uint8_t DELTA_KEYFRAME = 0x01;
+static const int DELTA_HEADER_BYTES = 20;
+static const int DELTA_RECORD_BYTES = 10;
+
+struct DeltaStats {
+    uint32_t bytes;         // size of the delta, including the header
+    uint16_t rects;
+    uint32_t pixels;        // area of the rects
+    uint32_t micros;        // time spent reading and applying
+};
+
+/**
+ * Applies deltas to a pair of planes and tracks the frame they show, so a delta made against
+ * another frame is skipped rather than XORed into the wrong pixels.
+ */
+class DeltaDecoder {
+    uint16_t _sequence = 0;
+    bool _synced = false;   // the planes show frame _sequence
+
+public:
+    // Reads one delta from source. Rects that were written are added to touched, even when the
+    // delta fails part way; the decoder then waits for a keyframe.
+    bool apply(BinaryMatrix &black, BinaryMatrix &red, ByteSource &source, DirtyRegion *touched = nullptr,
+        DeltaStats *stats = nullptr);
+
+    bool isSynced() const;
+    uint16_t sequence() const;
+
+    // Forgets the current frame, e.g. after the planes were drawn locally
+    void reset();
+
+private:
+    bool applyRecords(BinaryMatrix &black, BinaryMatrix &red, ByteSource &source, int count,
+        DirtyRegion *touched, DeltaStats *stats);
+};
+
+#endif
@@ -0,0 +1,186 @@
+#include "host_transport.h"
+
+#if defined(ARDUINO)
+#include <Arduino.h>
+#else
+#include <chrono>
+#endif
+
+// BUSY timing follows millis() when built with an Arduino core, so it agrees with the sketch
+static uint32_t elapsedMs() {
+#if defined(ARDUINO)
+    return millis();
+#else
+    static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+#endif
+}
+
+// RecordingTransport
+
+void RecordingTransport::begin(const EInkConfig &) {
+    clear();
+}
+
+void RecordingTransport::writeCommand(uint8_t command) {
+    _entries.push_back({ command, (uint32_t) _data.size(), 0 });
+}
+
+void RecordingTransport::beginData() {}
+
+void RecordingTransport::writeData(const uint8_t *data, uint32_t length) {
+    _dataBytes += length;
+    if (_entries.empty()) return;
+
+    _entries.back().dataLength += length;
+    if (_recordData) {
+        _data.insert(_data.end(), data, data + length);
+    }
+}
+
+void RecordingTransport::writeRepeat(uint8_t value, uint32_t count) {
+    _dataBytes += count;
+    if (_entries.empty()) return;
+
+    _entries.back().dataLength += count;
+    if (_recordData) {
+        _data.insert(_data.end(), count, value);
+    }
+}
+
+void RecordingTransport::endData() {}
+
+bool RecordingTransport::isBusy() {
+    return false;
+}
+
+void RecordingTransport::setReset(bool high) {
+    if (!high) _resets++;
+}
+
+void RecordingTransport::delayMs(uint32_t ms) {
+    _delayMs += ms;
+}
+
+void RecordingTransport::setRecordData(bool record) {
+    _recordData = record;
+}
+
+void RecordingTransport::clear() {
+    _entries.clear();
+    _data.clear();
+    _dataBytes = 0;
+    _delayMs = 0;
+    _resets = 0;
+}
+
+const std::vector<RecordingTransport::Entry> &RecordingTransport::entries() const {
+    return _entries;
+}
+
+const std::vector<uint8_t> &RecordingTransport::data() const {
+    return _data;
+}
+
+uint32_t RecordingTransport::dataBytes() const {
+    return _dataBytes;
+}
+
+uint32_t RecordingTransport::delayedMs() const {
+    return _delayMs;
+}
+
+uint32_t RecordingTransport::resets() const {
+    return _resets;
+}
+
+
+// EmulatorTransport
+
+void EmulatorTransport::begin(const EInkConfig &config) {
+    _panel = config.panel;
+    _width = config.width / 8;
+    _height = config.height;
+
+    _blackRam.assign((uint32_t) _width * _height, 0);
+    _redRam.assign((uint32_t) _width * _height, 0);
+}
+
+void EmulatorTransport::writeCommand(uint8_t command) {
+    _command = command;
+    _paramCount = 0;
+
+    if (command == 0x20) { // master activation
+        _activations++;
+        _busyUntil = elapsedMs() + _refreshMs;
+    }
+}
+
+void EmulatorTransport::beginData() {}
+
+void EmulatorTransport::writeData(const uint8_t *data, uint32_t length) {
+    if (_command == _panel->cmdWriteBlack || _command == _panel->cmdWriteRed) {
+        for (uint32_t i = 0; i < length; i++) writeRam(data[i]);
+        return;
+    }
+
+    for (uint32_t i = 0; i < length; i++) {
+        if (_paramCount < sizeof(_params)) _params[_paramCount++] = data[i];
+    }
+
+    // Address counters are in pixels for x and rows for y
+    if (_command == _panel->cmdRamX && _paramCount == 2) {
+        _x = (_params[0] | (_params[1] << 8)) / 8;
+    } else if (_command == _panel->cmdRamY && _paramCount == 2) {
+        _y = _params[0] | (_params[1] << 8);
+    }
+}
+
+void EmulatorTransport::writeRepeat(uint8_t value, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) writeData(&value, 1);
+}
+
+void EmulatorTransport::endData() {}
+
+bool EmulatorTransport::isBusy() {
+    return (int32_t) (_busyUntil - elapsedMs()) > 0;
+}
+
+void EmulatorTransport::setReset(bool) {}
+
+void EmulatorTransport::delayMs(uint32_t ms) {
+    _virtualMs += ms;
+}
+
+const uint8_t *EmulatorTransport::blackRam() const {
+    return _blackRam.data();
+}
+
+const uint8_t *EmulatorTransport::redRam() const {
+    return _redRam.data();
+}
+
+uint32_t EmulatorTransport::activations() const {
+    return _activations;
+}
+
+uint32_t EmulatorTransport::virtualMs() const {
+    return _virtualMs;
+}
+
+void EmulatorTransport::setRefreshMs(uint32_t ms) {
+    _refreshMs = ms;
+}
+
+void EmulatorTransport::writeRam(uint8_t value) {
+    if (_x < _width && _y < _height) {
+        std::vector<uint8_t> &ram = _command == _panel->cmdWriteBlack ? _blackRam : _redRam;
+        ram[(uint32_t) _y * _width + _x] = value;
+    }
+
+    // x+, y+ data entry: x wraps to the start of the next row
+    if (++_x >= _width) {
+        _x = 0;
+        if (++_y >= _height) _y = 0;
+    }
+}
@@ -0,0 +1,112 @@
+#ifndef host_transport_h
+#define host_transport_h
+
+#include <stdint.h>
+#include <vector>
+
+#include "panel_profile.h"
+
+/*
+ * Transports that touch no hardware, for tests and host builds. They only use the standard
+ * library, so a host program can drive BasicEInkDisplay without an Arduino core; see
+ * display_transport.h for the interface.
+ */
+
+/**
+ * Records everything sent to the controller without touching any hardware. BUSY is never set
+ * and delays return immediately.
+ */
+class RecordingTransport {
+public:
+    struct Entry {
+        uint8_t command;
+        uint32_t dataOffset;    // into data()
+        uint32_t dataLength;
+    };
+
+private:
+    std::vector<Entry> _entries;
+    std::vector<uint8_t> _data;
+    bool _recordData = true;
+
+    uint32_t _dataBytes = 0;
+    uint32_t _delayMs = 0;
+    uint32_t _resets = 0;
+
+public:
+    void begin(const EInkConfig &config);
+
+    void writeCommand(uint8_t command);
+    void beginData();
+    void writeData(const uint8_t *data, uint32_t length);
+    void writeRepeat(uint8_t value, uint32_t count);
+    void endData();
+
+    bool isBusy();
+    void setReset(bool high);
+    void delayMs(uint32_t ms);
+
+    // Only count data bytes instead of storing them
+    void setRecordData(bool record);
+    void clear();
+
+    const std::vector<Entry> &entries() const;
+    const std::vector<uint8_t> &data() const;
+    uint32_t dataBytes() const;
+    uint32_t delayedMs() const;
+    uint32_t resets() const;
+};
+
+/**
+ * Emulates the RAM of an SSD16xx controller on the host, so frames can be inspected and the
+ * driver benchmarked off-device. Only RAM addressing and RAM writes are modeled, with the
+ * x+, y+ data entry mode. Delays only advance a virtual clock, and BUSY is only set after an
+ * activation if setRefreshMs() was called.
+ */
+class EmulatorTransport {
+    const PanelProfile *_panel = nullptr;
+    uint16_t _width = 0;        // in bytes
+    uint16_t _height = 0;
+
+    std::vector<uint8_t> _blackRam;
+    std::vector<uint8_t> _redRam;
+
+    uint8_t _command = 0;
+    uint8_t _params[4];
+    uint8_t _paramCount = 0;
+
+    uint16_t _x = 0;            // in bytes
+    uint16_t _y = 0;
+
+    uint32_t _activations = 0;
+    uint32_t _virtualMs = 0;
+
+    uint32_t _refreshMs = 0;
+    uint32_t _busyUntil = 0;    // real time, millis() on the device
+
+public:
+    void begin(const EInkConfig &config);
+
+    void writeCommand(uint8_t command);
+    void beginData();
+    void writeData(const uint8_t *data, uint32_t length);
+    void writeRepeat(uint8_t value, uint32_t count);
+    void endData();
+
+    bool isBusy();
+    void setReset(bool high);
+    void delayMs(uint32_t ms);
+
+    const uint8_t *blackRam() const;
+    const uint8_t *redRam() const;
+    uint32_t activations() const;
+    uint32_t virtualMs() const;
+
+    // Keeps BUSY set for ms of real time after every activation, to exercise async refreshes
+    void setRefreshMs(uint32_t ms);
+
+private:
+    void writeRam(uint8_t value);
+};
+
+#endif
@@ -16,6 +16,10 @@ Image Image::asImage(const void *imageStruct) {
     return img;
 }
 
+Image Image::fromBitmap(const CompiledBitmap &bitmap) {
+    return Image(bitmap.width, bitmap.height, 0, (unsigned char*) bitmap.bits);
+}
+
 Image::Image(unsigned int w, unsigned int h, unsigned int bpp, unsigned char *data) : 
     width(w), height(h), bytes_per_pixel(bpp), pixel_data(data) { }
 
@@ -31,6 +35,18 @@ float Image::getScale() const {
 }
 
 Pixel Image::pixelAt(int x, int y) const {
+    if (bytes_per_pixel == 0) {
+        if (scale != 1.0f) {
+            x = (float) x / scale;
+            y = (float) y / scale;
+        }
+
+        // Reported as RGB565 black or white
+        const uint8_t byte = pgm_read_byte(pixel_data + y * ((width + 7) / 8) + x / 8);
+        const bool ink = (byte >> (7 - x % 8)) & 1;
+        return ink ? Pixel(0, 0, 0, 0) : Pixel(0x1F, 0x3F, 0x1F, 0);
+    }
+
     int offset;
     if (scale == 1.0f) {
         offset = (width * y * bytes_per_pixel) + (x * bytes_per_pixel);
@@ -4,6 +4,8 @@
 #include <Arduino.h>
 #include <pgmspace.h>
 
+#include "compiled_asset.h"
+
 template<typename T>
 // sizeof(void) = 1
 T derefByte(const void *ptr, int byteOffset) {
@@ -42,10 +44,12 @@ public:
 
     const unsigned int width;
     const unsigned int height;
-    const unsigned int bytes_per_pixel; /* 2: RGB16, 3: RGB, 4: RGBA */
+    const unsigned int bytes_per_pixel; /* 0: 1-bit packed, 2: RGB16, 3: RGB, 4: RGBA */
     const unsigned char *pixel_data;
 
     static Image asImage(const void *imageStruct);
+    // Wraps a bitmap generated by tools/asset_compiler.py
+    static Image fromBitmap(const CompiledBitmap &bitmap);
 
     Image(unsigned int w, unsigned int h, unsigned int bpp, unsigned char *data);
 
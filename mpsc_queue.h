@@ -0,0 +1,100 @@
+#ifndef mpsc_queue_h
+#define mpsc_queue_h
+
+#include <atomic>
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ * Bounded lock-free queue for many producers and one consumer (D. Vyukov's bounded queue). Each
+ * cell holds a sequence number telling whether it is free for the producer that claimed its
+ * position or ready for the consumer, so producers only contend on one compare-and-swap and
+ * never wait for each other or the consumer. push() fails instead of blocking when the queue is
+ * full.
+ *
+ * Only depends on <atomic>, so it builds on the host as well as under FreeRTOS.
+ */
+template<class T>
+class MpscQueue {
+    struct Cell {
+        std::atomic<uint32_t> sequence;
+        T value;
+    };
+
+    Cell *_cells;
+    const uint32_t _mask;
+    std::atomic<uint32_t> _enqueuePos;
+    uint32_t _dequeuePos = 0;   // consumer only
+    std::atomic<uint32_t> _rejected;
+
+    static uint32_t roundUp(uint32_t capacity) {
+        uint32_t size = 2;
+        while (size < capacity) size <<= 1;
+        return size;
+    }
+
+public:
+    // capacity is rounded up to a power of two
+    MpscQueue(uint32_t capacity) : _mask(roundUp(capacity) - 1), _enqueuePos(0), _rejected(0) {
+        _cells = new Cell[_mask + 1];
+        for (uint32_t i = 0; i <= _mask; i++) {
+            _cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~MpscQueue() {
+        delete[] _cells;
+    }
+
+    MpscQueue(const MpscQueue &) = delete;
+    MpscQueue &operator=(const MpscQueue &) = delete;
+
+    // Any task. Returns false if the queue is full.
+    bool push(const T &value) {
+        uint32_t pos = _enqueuePos.load(std::memory_order_relaxed);
+        Cell *cell;
+
+        while (true) {
+            cell = &_cells[pos & _mask];
+            const int32_t diff = (int32_t) (cell->sequence.load(std::memory_order_acquire) - pos);
+
+            if (diff == 0) {
+                // The cell is free; claim the position unless another producer did first
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                // The consumer has not freed the cell from the previous lap yet
+                _rejected.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->value = value;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer task only. Returns false if the queue is empty.
+    bool pop(T &value) {
+        Cell *cell = &_cells[_dequeuePos & _mask];
+        const int32_t diff = (int32_t) (cell->sequence.load(std::memory_order_acquire) - (_dequeuePos + 1));
+        if (diff < 0) return false;
+
+        value = cell->value;
+        cell->sequence.store(_dequeuePos + _mask + 1, std::memory_order_release);
+        _dequeuePos++;
+        return true;
+    }
+
+    uint32_t capacity() const {
+        return _mask + 1;
+    }
+
+    // Number of push() calls that failed because the queue was full
+    uint32_t rejected() const {
+        return _rejected.load(std::memory_order_relaxed);
+    }
+};
+
+#endif
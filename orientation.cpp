@@ -0,0 +1,169 @@
+#include "orientation.h"
+
+Orientation::Orientation() {}
+
+Orientation::Orientation(Rotation rotation, bool mirror) : rotation(rotation), mirror(mirror) {}
+
+bool Orientation::isIdentity() const {
+    return rotation == ROTATE_0 && !mirror;
+}
+
+bool Orientation::swapsAxes() const {
+    return rotation == ROTATE_90 || rotation == ROTATE_270;
+}
+
+void Orientation::toPanelRect(int logicalWidth, int logicalHeight, int &x, int &y, int &width, int &height) const {
+    const int lx = x;
+    const int ly = y;
+    const int lw = width;
+    const int lh = height;
+
+    switch (rotation) {
+        case ROTATE_0:
+            break;
+        case ROTATE_90: // (px, py) = (panelWidth - 1 - ly, lx)
+            x = logicalHeight - ly - lh;
+            y = lx;
+            width = lh;
+            height = lw;
+            break;
+        case ROTATE_180: // (px, py) = (panelWidth - 1 - lx, panelHeight - 1 - ly)
+            x = logicalWidth - lx - lw;
+            y = logicalHeight - ly - lh;
+            break;
+        case ROTATE_270: // (px, py) = (ly, panelHeight - 1 - lx)
+            x = ly;
+            y = logicalWidth - lx - lw;
+            width = lh;
+            height = lw;
+            break;
+    }
+
+    if (mirror) {
+        const int panelWidth = swapsAxes() ? logicalHeight : logicalWidth;
+        x = panelWidth - x - width;
+    }
+}
+
+
+PanelRowReader::PanelRowReader(const BinaryMatrix &frame, Orientation orientation) :
+    _frame(frame), _orientation(orientation) {
+
+    _panelWidth = orientation.swapsAxes() ? frame.height : frame.width;
+    _panelHeight = orientation.swapsAxes() ? frame.width : frame.height;
+
+    if (orientation.swapsAxes()) {
+        if (_panelWidth % 8 != 0 || _panelHeight % 8 != 0) {
+            Serial.printf("Error: rotated panel size must be a multiple of 8, is (%d,%d)\n", _panelWidth, _panelHeight);
+        }
+        _strip = (uint8_t*) malloc(_panelWidth); // 8 rows of panelWidth / 8 bytes
+    }
+}
+
+PanelRowReader::~PanelRowReader() {
+    free(_strip);
+}
+
+int PanelRowReader::panelWidth() const {
+    return _panelWidth;
+}
+
+int PanelRowReader::panelHeight() const {
+    return _panelHeight;
+}
+
+void PanelRowReader::read(int y, int byteX0, int byteX1, uint8_t *out) {
+    const int panelBytes = _panelWidth / 8;
+    const int count = byteX1 - byteX0;
+
+    if (_orientation.swapsAxes()) {
+        const int stripY = y & ~7;
+        if (stripY != _stripY || byteX0 < _stripByteX0 || byteX1 > _stripByteX1) {
+            readStrip(stripY, byteX0, byteX1);
+        }
+
+        memcpy(out, _strip + (y - stripY) * panelBytes + byteX0, count);
+        return;
+    }
+
+    // Without swapped axes a panel row is a logical row, read forwards or backwards
+    const int ly = _orientation.rotation == ROTATE_180 ? _panelHeight - 1 - y : y;
+    const uint8_t *row = _frame.rowData(ly);
+    const bool reversed = (_orientation.rotation == ROTATE_180) != _orientation.mirror;
+
+    if (!reversed) {
+        memcpy(out, row + byteX0, count);
+        return;
+    }
+
+    for (int i = 0; i < count; i++) {
+        out[i] = reverseBits(row[panelBytes - 1 - (byteX0 + i)]);
+    }
+}
+
+void PanelRowReader::readStrip(int stripY, int byteX0, int byteX1) {
+    const int panelBytes = _panelWidth / 8;
+    const int by = stripY / 8;
+
+    for (int bx = byteX0; bx < byteX1; bx++) {
+        // Mirroring reads the opposite block and reverses its bits afterwards
+        const int c = _orientation.mirror ? panelBytes - 1 - bx : bx;
+
+        uint8_t block[8];
+        uint8_t transposed[8];
+
+        if (_orientation.rotation == ROTATE_90) {
+            // Panel block (c, by) comes from logical rows panelWidth-1-8c down to panelWidth-8-8c
+            for (int k = 0; k < 8; k++) {
+                block[k] = _frame.rowData(_panelWidth - 1 - 8 * c - k)[by];
+            }
+            transpose8x8(block, transposed);
+        } else {
+            // ROTATE_270: logical rows 8c to 8c+7, mirrored column, transposed rows in reverse order
+            const int column = _frame.width / 8 - 1 - by;
+            for (int k = 0; k < 8; k++) {
+                block[k] = _frame.rowData(8 * c + k)[column];
+            }
+            uint8_t t[8];
+            transpose8x8(block, t);
+            for (int j = 0; j < 8; j++) transposed[j] = t[7 - j];
+        }
+
+        for (int j = 0; j < 8; j++) {
+            _strip[j * panelBytes + bx] = _orientation.mirror ? reverseBits(transposed[j]) : transposed[j];
+        }
+    }
+
+    _stripY = stripY;
+    _stripByteX0 = byteX0;
+    _stripByteX1 = byteX1;
+}
+
+uint8_t reverseBits(uint8_t b) {
+    static const uint8_t NIBBLES[16] = {
+        0x0, 0x8, 0x4, 0xC, 0x2, 0xA, 0x6, 0xE,
+        0x1, 0x9, 0x5, 0xD, 0x3, 0xB, 0x7, 0xF
+    };
+    return (NIBBLES[b & 0x0F] << 4) | NIBBLES[b >> 4];
+}
+
+void transpose8x8(const uint8_t in[8], uint8_t out[8]) {
+    uint64_t x = 0;
+    for (int i = 0; i < 8; i++) {
+        x = (x << 8) | in[i];
+    }
+
+    // Hacker's Delight, transpose8: swap 1x1, then 2x2, then 4x4 blocks
+    uint64_t t;
+    t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL;
+    x = x ^ t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL;
+    x = x ^ t ^ (t << 14);
+    t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL;
+    x = x ^ t ^ (t << 28);
+
+    for (int j = 7; j >= 0; j--) {
+        out[j] = x & 0xFF;
+        x >>= 8;
+    }
+}
@@ -0,0 +1,74 @@
+#ifndef orientation_h
+#define orientation_h
+
+#include <Arduino.h>
+
+#include "binary_matrix.h"
+
+// Clockwise rotation of the drawing surface on the panel
+enum Rotation : uint8_t {
+    ROTATE_0,
+    ROTATE_90,
+    ROTATE_180,
+    ROTATE_270
+};
+
+/**
+ * How the frame drawn by the renderer (logical coordinates) is laid out on the panel. Mirroring
+ * flips the panel image horizontally after rotating.
+ */
+struct Orientation {
+    Rotation rotation = ROTATE_0;
+    bool mirror = false;
+
+    Orientation();
+    Orientation(Rotation rotation, bool mirror = false);
+
+    bool isIdentity() const;
+    bool swapsAxes() const;
+
+    // Converts a rect in logical coordinates into the rect it covers on the panel
+    void toPanelRect(int logicalWidth, int logicalHeight, int &x, int &y, int &width, int &height) const;
+};
+
+/**
+ * Reads rows of panel RAM bytes out of a frame in logical coordinates. Rotation and mirroring
+ * happen here, while the rows are being streamed to the controller, so drawing never pays
+ * for them.
+ *
+ * For 90 and 270 degrees a strip of 8 panel rows is produced at once, by transposing 8x8 pixel
+ * blocks held in a 64-bit word. Both panel dimensions must then be multiples of 8.
+ */
+class PanelRowReader {
+    const BinaryMatrix &_frame;
+    const Orientation _orientation;
+
+    int _panelWidth;
+    int _panelHeight;
+
+    // 8 transposed panel rows, for byte columns [_stripByteX0, _stripByteX1)
+    uint8_t *_strip = nullptr;
+    int _stripY = -1;
+    int _stripByteX0 = 0;
+    int _stripByteX1 = 0;
+
+public:
+    PanelRowReader(const BinaryMatrix &frame, Orientation orientation);
+    ~PanelRowReader();
+
+    int panelWidth() const;
+    int panelHeight() const;
+
+    // Writes the bytes [byteX0, byteX1) of panel row y into out
+    void read(int y, int byteX0, int byteX1, uint8_t *out);
+
+private:
+    void readStrip(int stripY, int byteX0, int byteX1);
+};
+
+uint8_t reverseBits(uint8_t b);
+
+// Transposes an 8x8 bit block: bit (7 - i) of out[j] is bit (7 - j) of in[i]
+void transpose8x8(const uint8_t in[8], uint8_t out[8]);
+
+#endif
@@ -0,0 +1,90 @@
+// Documentation for ink display: https://www.waveshare.com/w/upload/9/94/7.5inch_HD_e-Paper_B_Datasheet.pdf
+
+#include "panel_profile.h"
+
+#include <pgmspace.h>
+
+static constexpr uint8_t WS_7IN5_HD_B_INIT[] PROGMEM = {
+    SCRIPT_CMD, 0x12,                   // reset
+    SCRIPT_WAIT_BUSY,
+
+    SCRIPT_CMD, 0x46,                   // Auto write for red
+    SCRIPT_DATA, 1, 0xF7,
+    SCRIPT_WAIT_BUSY,
+
+    SCRIPT_CMD, 0x47,                   // Auto write for white
+    SCRIPT_DATA, 1, 0xF7,
+    SCRIPT_WAIT_BUSY,
+
+    SCRIPT_CMD, 0x0C,                   // Soft start setting
+    SCRIPT_DATA, 5, 0xAE, 0xC7, 0xC3, 0xC0, 0x40,
+
+    SCRIPT_CMD, 0x01,                   // Set MUX as 527
+    SCRIPT_DATA, 3, 0x0F, 0x02, 0x00,
+
+    SCRIPT_CMD, 0x11,                   // Data entry
+    SCRIPT_DATA, 1, 0x03,               // x+, y+, x+ increment
+
+    SCRIPT_CMD, 0x44,                   // Start/end pos of RAM x
+    SCRIPT_DATA, 4, 0x00, 0x00,         // start at 0
+                    0x6F, 0x03,         // end at 36F_h = 879
+
+    SCRIPT_CMD, 0x45,                   // Start/end pos of RAM y
+    SCRIPT_DATA, 4, 0x00, 0x00,         // start at 0
+                    0x0F, 0x02,         // end at 20F_h = 527
+
+    SCRIPT_CMD, 0x3C,                   // VBD
+    SCRIPT_DATA, 1, 0x01,               // LUT1, for white
+
+    SCRIPT_CMD, 0x18,                   // Temperature sensor
+    SCRIPT_DATA, 1, 0x80,               // internal
+
+    SCRIPT_CMD, 0x22,                   // Display update control 2
+    SCRIPT_DATA, 1, 0xB1,               // Load Temperature and waveform setting.
+
+    SCRIPT_CMD, 0x20,                   // Master activation
+    SCRIPT_WAIT_BUSY,
+
+    SCRIPT_CMD, 0x4E,                   // Initial RAM x
+    SCRIPT_DATA, 2, 0x00, 0x00,         // addr 0
+    SCRIPT_CMD, 0x4F,                   // Initial RAM y
+    SCRIPT_DATA, 2, 0x00, 0x00,         // addr 0
+
+    SCRIPT_END
+};
+
+static constexpr uint8_t WS_7IN5_HD_B_REFRESH[] PROGMEM = {
+    SCRIPT_CMD, 0x22,                   // display update control 2
+    SCRIPT_DATA, 1, 0xC7,
+    SCRIPT_CMD, 0x20,                   // master activation
+    SCRIPT_DELAY, 10,
+    SCRIPT_WAIT_BUSY,
+    SCRIPT_END
+};
+
+static constexpr uint8_t WS_7IN5_HD_B_SLEEP[] PROGMEM = {
+    SCRIPT_CMD, 0x10,                   // deep sleep
+    SCRIPT_DATA, 1, 0x03,
+    SCRIPT_END
+};
+
+const PanelProfile WAVESHARE_7IN5_HD_B = {
+    "Waveshare 7.5 inch HD (B)",
+
+    WS_7IN5_HD_B_INIT,
+    WS_7IN5_HD_B_REFRESH,
+    WS_7IN5_HD_B_SLEEP,
+
+    0x4E,
+    0x4F,
+    0x24,
+    0x26,
+
+    0xFF,   // white
+    0x00,   // white
+    true,
+};
+
+EInkConfig::EInkConfig(int width, int height) : width(width), height(height) {}
+
+EInkConfig::EInkConfig(int width, int height, int cs, int dc, int busy, int reset) : width(width), height(height), cs(cs), dc(dc), busy(busy), reset(reset) {}
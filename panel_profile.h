@@ -0,0 +1,65 @@
+#ifndef panel_profile_h
+#define panel_profile_h
+
+#include <stdint.h>
+
+/**
+ * Controller sequences are stored as byte scripts and executed by EInkDisplay::runScript.
+ *
+ *   SCRIPT_CMD, c          send command byte c
+ *   SCRIPT_DATA, n, d...   send n data bytes in a single burst (for the preceding command)
+ *   SCRIPT_WAIT_BUSY       wait until the BUSY line is released
+ *   SCRIPT_DELAY, ms       wait for ms milliseconds (0-255)
+ *   SCRIPT_END             end of script
+ *
+ * Scripts may be stored on PROGMEM.
+ */
+enum ScriptOp : uint8_t {
+    SCRIPT_END = 0x00,
+    SCRIPT_CMD = 0x01,
+    SCRIPT_DATA = 0x02,
+    SCRIPT_WAIT_BUSY = 0x03,
+    SCRIPT_DELAY = 0x04,
+};
+
+/**
+ * Everything that differs between SSD16xx based panels. Adding a new panel is a matter of
+ * writing its scripts and filling in a profile; the display code stays the same.
+ */
+struct PanelProfile {
+    const char *name;
+
+    const uint8_t *initScript;      // run after reset
+    const uint8_t *refreshScript;   // displays the RAM contents, ends when the refresh is done
+    const uint8_t *sleepScript;
+
+    uint8_t cmdRamX;                // set RAM x address counter
+    uint8_t cmdRamY;                // set RAM y address counter
+    uint8_t cmdWriteBlack;          // write to black/white RAM
+    uint8_t cmdWriteRed;            // write to red RAM
+
+    uint8_t clearBlack;             // byte written to black/white RAM when clearing
+    uint8_t clearRed;               // byte written to red RAM when clearing
+    bool invertBlack;               // black/white RAM uses 1 for white
+};
+
+// Waveshare 7.5 inch HD (B), 880x528, SSD1677 controller
+extern const PanelProfile WAVESHARE_7IN5_HD_B;
+
+// Pins and panel of one display
+struct EInkConfig {
+    int width;
+    int height;
+
+    int cs = 26;
+    int dc = 25;
+    int busy = 33;
+    int reset = 32;
+
+    const PanelProfile *panel = &WAVESHARE_7IN5_HD_B;
+
+    EInkConfig(int width, int height);
+    EInkConfig(int width, int height, int cs, int dc, int busy, int reset);
+};
+
+#endif
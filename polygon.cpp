@@ -0,0 +1,169 @@
+#include "polygon.h"
+
+#include <algorithm>
+
+// Coordinates along x are 16.16 fixed point while scanning
+static const int FIXED_SHIFT = 16;
+static const int32_t FIXED_ONE = 1 << FIXED_SHIFT;
+static const int32_t FIXED_HALF = FIXED_ONE / 2;
+
+struct Edge {
+    int32_t x;      // x at the center of the current row
+    int32_t dx;     // change of x per row
+    int16_t yTop;   // first row crossed
+    int16_t yEnd;   // row after the last one crossed
+    int8_t winding; // +1 for edges going down, -1 for edges going up
+};
+
+// First pixel whose center is at or right of x
+static inline int pixelAt(int32_t x) {
+    return (x + FIXED_HALF - 1) >> FIXED_SHIFT;
+}
+
+void scanPolygon(const Point *points, const uint16_t *contourSizes, int contours, FillRule rule,
+    Rect clip, SpanSink sink, void *context) {
+
+    int total = 0;
+    for (int c = 0; c < contours; c++) total += contourSizes[c];
+    if (total < 3 || clip.isEmpty()) return;
+
+    Edge *edges = (Edge*) malloc(total * sizeof(Edge));
+    Edge **active = (Edge**) malloc(total * sizeof(Edge*));
+    if (edges == nullptr || active == nullptr) {
+        Serial.printf("Error: not enough memory to fill a polygon of %d points\n", total);
+        free(edges);
+        free(active);
+        return;
+    }
+
+    // Edge table: every edge that crosses a pixel center inside the clip rows
+    const int clipTop = clip.y;
+    const int clipEnd = clip.y + clip.height;
+    int edgeCount = 0;
+
+    const Point *contour = points;
+    for (int c = 0; c < contours; c++) {
+        const int size = contourSizes[c];
+
+        for (int i = 0; i < size; i++) {
+            Point a = contour[i];
+            Point b = contour[(i + 1) % size];
+            if (a.y == b.y) continue; // horizontal edges are covered by the edges joining them
+
+            int8_t winding = 1;
+            if (a.y > b.y) {
+                std::swap(a, b);
+                winding = -1;
+            }
+
+            // Rows whose center lies in [a.y, b.y)
+            const int yTop = max((int) a.y, clipTop);
+            const int yEnd = min((int) b.y, clipEnd);
+            if (yTop >= yEnd) continue;
+
+            Edge &e = edges[edgeCount++];
+            e.dx = (int32_t) ((int64_t) (b.x - a.x) * FIXED_ONE / (b.y - a.y));
+            // x at the center of row yTop, i.e. at y = yTop + 0.5
+            e.x = (int32_t) a.x * FIXED_ONE + (int32_t) ((int64_t) (b.x - a.x) * (2 * (yTop - a.y) + 1) * FIXED_ONE / (2 * (b.y - a.y)));
+            e.yTop = yTop;
+            e.yEnd = yEnd;
+            e.winding = winding;
+        }
+
+        contour += size;
+    }
+
+    std::sort(edges, edges + edgeCount, [](const Edge &a, const Edge &b) { return a.yTop < b.yTop; });
+
+    const int clipRight = clip.x + clip.width;
+    int next = 0;       // next edge of the table to become active
+    int activeCount = 0;
+
+    const int yStart = edgeCount > 0 ? edges[0].yTop : clipEnd;
+    for (int y = yStart; y < clipEnd && (next < edgeCount || activeCount > 0); y++) {
+        // Drop finished edges, add the ones starting on this row
+        int kept = 0;
+        for (int i = 0; i < activeCount; i++) {
+            if (active[i]->yEnd > y) active[kept++] = active[i];
+        }
+        activeCount = kept;
+
+        while (next < edgeCount && edges[next].yTop == y) {
+            active[activeCount++] = &edges[next++];
+        }
+
+        // The list stays nearly sorted between rows, so insertion sort is close to linear
+        for (int i = 1; i < activeCount; i++) {
+            Edge *e = active[i];
+            int j = i - 1;
+            while (j >= 0 && active[j]->x > e->x) {
+                active[j + 1] = active[j];
+                j--;
+            }
+            active[j + 1] = e;
+        }
+
+        int winding = 0;
+        int32_t spanStart = 0;
+        for (int i = 0; i < activeCount; i++) {
+            const Edge *e = active[i];
+            const bool wasInside = rule == FILL_EVEN_ODD ? (winding & 1) : winding != 0;
+            winding += rule == FILL_EVEN_ODD ? 1 : e->winding;
+            const bool inside = rule == FILL_EVEN_ODD ? (winding & 1) : winding != 0;
+
+            if (!wasInside && inside) {
+                spanStart = e->x;
+            } else if (wasInside && !inside) {
+                const int x0 = max(pixelAt(spanStart), clip.x);
+                const int x1 = min(pixelAt(e->x), clipRight);
+                if (x0 < x1) sink(context, y, x0, x1);
+            }
+        }
+
+        for (int i = 0; i < activeCount; i++) {
+            active[i]->x += active[i]->dx;
+        }
+    }
+
+    free(edges);
+    free(active);
+}
+
+void scanPolygon(const Point *points, int count, FillRule rule, Rect clip, SpanSink sink, void *context) {
+    const uint16_t size = count;
+    scanPolygon(points, &size, 1, rule, clip, sink, context);
+}
+
+int arcPoints(int centerX, int centerY, int innerRadius, int outerRadius, float startAngle, float endAngle,
+    Point *points, int maxPoints) {
+
+    if (endAngle < startAngle) std::swap(startAngle, endAngle);
+    const float sweep = min(endAngle - startAngle, 360.0f) * (float) PI / 180;
+    const float start = startAngle * (float) PI / 180;
+
+    // Steps small enough that a chord is at most half a pixel away from the outer arc
+    const float step = outerRadius > 1 ? 2 * acosf(1 - 0.5f / outerRadius) : (float) PI / 4;
+    int segments = max(1, (int) ceilf(sweep / step));
+
+    const int perArc = innerRadius > 0 ? 2 : 1;
+    if (innerRadius <= 0) maxPoints--; // room for the center
+    segments = min(segments, maxPoints / perArc - 1);
+    if (segments < 1) return 0;
+
+    int n = 0;
+    for (int i = 0; i <= segments; i++) {
+        const float a = start + sweep * i / segments;
+        points[n++] = { (int16_t) lroundf(centerX + outerRadius * cosf(a)), (int16_t) lroundf(centerY + outerRadius * sinf(a)) };
+    }
+
+    if (innerRadius <= 0) {
+        points[n++] = { (int16_t) centerX, (int16_t) centerY };
+        return n;
+    }
+
+    for (int i = segments; i >= 0; i--) {
+        const float a = start + sweep * i / segments;
+        points[n++] = { (int16_t) lroundf(centerX + innerRadius * cosf(a)), (int16_t) lroundf(centerY + innerRadius * sinf(a)) };
+    }
+    return n;
+}
@@ -0,0 +1,51 @@
+#ifndef polygon_h
+#define polygon_h
+
+#include <Arduino.h>
+
+#include "binary_matrix.h"
+
+struct Point {
+    int16_t x;
+    int16_t y;
+};
+
+/**
+ * Which points are inside a polygon whose edges cross or whose contours nest
+ */
+enum FillRule : uint8_t {
+    FILL_EVEN_ODD,  // inside when a ray to the left crosses an odd number of edges
+    FILL_NON_ZERO,  // inside when the edges crossed do not wind to zero
+};
+
+// Receives the pixels [x0, x1) of row y that are inside the polygon
+typedef void (*SpanSink)(void *context, int y, int x0, int x1);
+
+/**
+ * Scanline polygon fill. Edges are bucketed by their top row in an edge table and moved into an
+ * active edge list while the scanline passes them; the crossings of the active edges are sorted
+ * along x and paired into spans according to rule. Cost is O(edges + spans), independent of the
+ * area filled.
+ *
+ * A pixel is inside when its center is. Vertices are in pixel corner coordinates, so the polygon
+ * (0,0) (10,0) (10,10) (0,10) covers the same pixels as a 10x10 rect at (0,0).
+ *
+ * A polygon may have several contours (e.g. a ring as outer and inner contour), given as
+ * contourSizes[contours] consecutive runs of points; each contour is closed automatically.
+ * Spans are clipped to clip.
+ */
+void scanPolygon(const Point *points, const uint16_t *contourSizes, int contours, FillRule rule,
+    Rect clip, SpanSink sink, void *context);
+
+// Single contour of count points
+void scanPolygon(const Point *points, int count, FillRule rule, Rect clip, SpanSink sink, void *context);
+
+/**
+ * Outline points of an annular sector: the outer arc from startAngle to endAngle followed by the
+ * inner arc back. Angles are in degrees, clockwise from the positive x axis. With an inner radius
+ * of 0 this is a pie slice. Returns the number of points written, at most maxPoints.
+ */
+int arcPoints(int centerX, int centerY, int innerRadius, int outerRadius, float startAngle, float endAngle,
+    Point *points, int maxPoints);
+
+#endif
@@ -0,0 +1,96 @@
+#include "render_scheduler.h"
+
+void SchedulerStats::reset() {
+    memset(this, 0, sizeof(SchedulerStats));
+}
+
+RenderScheduler::RenderScheduler(Renderer &renderer, uint32_t minIntervalMs) :
+    _renderer(renderer), _minIntervalMs(minIntervalMs) {
+    _stats.reset();
+}
+
+void RenderScheduler::request(Rect rect, uint32_t deadlineMs, RenderPriority priority) {
+    const uint32_t now = millis();
+    const uint32_t due = priority == PRIORITY_URGENT ? now : now + deadlineMs;
+
+    _renderer.invalidate(rect);
+    _stats.requests++;
+
+    if (_deadlines.empty()) {
+        _firstRequest = now;
+        _due = due;
+    } else if ((int32_t) (due - _due) < 0) {
+        _due = due;
+    }
+    _deadlines.push_back(due);
+
+    if (priority != PRIORITY_BACKGROUND && _renderer.isBusy()) {
+        _waitedForRefresh = true;
+    }
+}
+
+bool RenderScheduler::poll() {
+    const bool busy = _renderer.isBusy();
+    const bool becameIdle = _wasBusy && !busy;
+    _wasBusy = busy;
+
+    if (_deadlines.empty() || busy) return false;
+
+    // Requests that had to wait behind a refresh go out as soon as it ends
+    if (becameIdle && _waitedForRefresh) {
+        _due = millis();
+    }
+
+    if ((int32_t) (millis() - fireTime()) < 0) return false;
+
+    fire();
+    return true;
+}
+
+void RenderScheduler::flush() {
+    if (_deadlines.empty()) return;
+
+    _renderer.waitIdle();
+    fire();
+}
+
+bool RenderScheduler::hasPending() const {
+    return !_deadlines.empty();
+}
+
+uint32_t RenderScheduler::msUntilDue() const {
+    if (_deadlines.empty()) return 0;
+
+    const int32_t remaining = (int32_t) (fireTime() - millis());
+    return remaining > 0 ? remaining : 0;
+}
+
+const SchedulerStats &RenderScheduler::stats() const {
+    return _stats;
+}
+
+uint32_t RenderScheduler::fireTime() const {
+    if (!_refreshed) return _due;
+
+    const uint32_t earliest = _lastRefresh + _minIntervalMs;
+    return (int32_t) (_due - earliest) > 0 ? _due : earliest;
+}
+
+void RenderScheduler::fire() {
+    const uint32_t now = millis();
+
+    _stats.refreshes++;
+    _stats.coalesced += _deadlines.size() - 1;
+    for (uint32_t due : _deadlines) {
+        if ((int32_t) (now - due) > 0) _stats.deadlineMisses++;
+    }
+    _stats.maxLatencyMs = max(_stats.maxLatencyMs, now - _firstRequest);
+
+    _deadlines.clear();
+    _waitedForRefresh = false;
+    _refreshed = true;
+    _lastRefresh = now;
+
+    _renderer.renderAsync();
+    _wasBusy = true;
+}
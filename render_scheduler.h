@@ -0,0 +1,72 @@
+#ifndef render_scheduler_h
+#define render_scheduler_h
+
+#include <Arduino.h>
+#include <vector>
+
+#include "renderer.h"
+
+enum RenderPriority : uint8_t {
+    PRIORITY_BACKGROUND,    // due at its deadline, never brings an update forward
+    PRIORITY_NORMAL,        // due at its deadline, or as soon as a refresh it waited for ends
+    PRIORITY_URGENT,        // due now; the minimum refresh interval still applies
+};
+
+struct SchedulerStats {
+    uint32_t requests;
+    uint32_t refreshes;
+    uint32_t coalesced;         // requests served by a refresh fired for an earlier request
+    uint32_t deadlineMisses;    // requests whose deadline passed before the refresh started
+    uint32_t maxLatencyMs;      // longest time from a request to its refresh
+
+    void reset();
+};
+
+/**
+ * Sits in front of Renderer::render() for firmware where several producers change the screen
+ * independently. Producers draw as usual and then request() an update of the rect they changed
+ * with a priority and the latest time it may reach the panel. poll() merges the pending requests
+ * into one refresh, fired when the earliest deadline is due, never while the panel is refreshing
+ * and never sooner than the minimum interval after the previous refresh.
+ */
+class RenderScheduler {
+    Renderer &_renderer;
+    const uint32_t _minIntervalMs;
+
+    bool _refreshed = false;    // false until the first refresh
+    uint32_t _lastRefresh = 0;  // millis()
+    bool _wasBusy = false;
+
+    // Pending requests, with the deadline of each so misses are counted per request. The
+    // vector keeps its capacity between refreshes.
+    std::vector<uint32_t> _deadlines;
+    uint32_t _firstRequest = 0;
+    uint32_t _due = 0;
+    bool _waitedForRefresh = false; // a normal request came in while the panel was busy
+
+    SchedulerStats _stats;
+
+public:
+    RenderScheduler(Renderer &renderer, uint32_t minIntervalMs);
+
+    // rect was changed and must be on the panel within deadlineMs
+    void request(Rect rect, uint32_t deadlineMs, RenderPriority priority = PRIORITY_NORMAL);
+
+    // Call often, e.g. from loop(). Returns true if it started a refresh.
+    bool poll();
+
+    // Starts a refresh of the pending requests now, ignoring deadlines and the minimum interval
+    void flush();
+
+    bool hasPending() const;
+    // Milliseconds until poll() would fire; 0 if due or nothing is pending
+    uint32_t msUntilDue() const;
+
+    const SchedulerStats &stats() const;
+
+private:
+    uint32_t fireTime() const;
+    void fire();
+};
+
+#endif
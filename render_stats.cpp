@@ -0,0 +1,31 @@
+#include "render_stats.h"
+
+void DisplayStats::reset() {
+    memset(this, 0, sizeof(DisplayStats));
+}
+
+void RenderStats::reset() {
+    memset(this, 0, sizeof(RenderStats));
+}
+
+void emitTrace(TraceSink sink, TraceType type, uint8_t arg, uint32_t value) {
+    if (sink == nullptr) return;
+
+    TraceEvent event;
+    event.type = type;
+    event.arg = arg;
+    event.timestamp = millis() & 0xFFFF;
+    event.value = value;
+    sink(event);
+}
+
+PrimitiveTimer::PrimitiveTimer(RenderStats &stats, TraceSink sink, StatPrimitive primitive) :
+    stats(stats), sink(sink), primitive(primitive), start(micros()) { }
+
+PrimitiveTimer::~PrimitiveTimer() {
+    uint32_t elapsed = micros() - start;
+
+    stats.primitiveCalls[primitive]++;
+    stats.rasterMicros[primitive] += elapsed;
+    emitTrace(sink, TRACE_PRIMITIVE, primitive, elapsed);
+}
@@ -0,0 +1,95 @@
+#ifndef render_stats_h
+#define render_stats_h
+
+#include <Arduino.h>
+
+/**
+ * Render instrumentation. Enable with -DEINK_STATS=1; when disabled nothing is collected and
+ * the stats/trace API is not compiled in.
+ */
+#ifndef EINK_STATS
+#define EINK_STATS 0
+#endif
+
+#if EINK_STATS
+#define EINK_STAT(statement) statement
+#else
+#define EINK_STAT(statement)
+#endif
+
+enum StatPrimitive : uint8_t {
+    STAT_RECT,
+    STAT_FILL_RECT,
+    STAT_ROUND_RECT,
+    STAT_CIRCLE,
+    STAT_LINE,
+    STAT_IMAGE,
+    STAT_TEXT,
+    STAT_BLIT,
+    STAT_POLYGON,
+    STAT_PRIMITIVE_COUNT
+};
+
+enum StatPlane : uint8_t {
+    STAT_PLANE_BLACK,
+    STAT_PLANE_RED,
+    STAT_PLANE_CONTROL,    // init, refresh and sleep scripts, RAM addressing
+    STAT_PLANE_COUNT
+};
+
+struct DisplayStats {
+    uint32_t bytesSent[STAT_PLANE_COUNT];
+    uint32_t commandsSent[STAT_PLANE_COUNT];
+    uint32_t spiMicros;     // time spent sending, excluding waits
+    uint32_t busyMicros;    // time spent waiting on BUSY
+
+    void reset();
+};
+
+struct RenderStats {
+    uint32_t primitiveCalls[STAT_PRIMITIVE_COUNT];
+    uint32_t rasterMicros[STAT_PRIMITIVE_COUNT];
+
+    uint32_t pixelsWritten;     // single pixel writes
+    uint32_t spansWritten;      // row spans written a byte at a time
+    uint32_t dirtyArea;         // in pixels
+    uint32_t frameMicros;       // time spent in render()
+
+    DisplayStats display;
+
+    void reset();
+};
+
+enum TraceType : uint8_t {
+    TRACE_PRIMITIVE,    // arg: StatPrimitive, value: micros
+    TRACE_TRANSFER,     // arg: StatPlane, value: bytes
+    TRACE_BUSY,         // value: micros
+    TRACE_FRAME,        // value: micros
+};
+
+// 8 bytes per event, so events can be buffered or streamed over serial as-is
+struct TraceEvent {
+    uint8_t type;
+    uint8_t arg;
+    uint16_t timestamp;     // millis() truncated to 16 bits
+    uint32_t value;
+};
+
+typedef void (*TraceSink)(const TraceEvent &event);
+
+void emitTrace(TraceSink sink, TraceType type, uint8_t arg, uint32_t value);
+
+/**
+ * Times a draw call for as long as it is in scope.
+ */
+struct PrimitiveTimer {
+    RenderStats &stats;
+    TraceSink sink;
+    StatPrimitive primitive;
+    uint32_t start;
+
+    PrimitiveTimer(RenderStats &stats, TraceSink sink, StatPrimitive primitive);
+    ~PrimitiveTimer();
+};
+
+#endif
@@ -1,64 +1,106 @@
 #include "renderer.h"
 
+#include "draw_queue.h"
 
-Renderer::Renderer(int width, int height) :
-    redData(BinaryMatrix(width, height)),
-    blackData(BinaryMatrix(width, height)),
-    display(EInkDisplay(EInkDisplay::Config(width, height))) {
 
+Renderer::Renderer(int width, int height, Rotation rotation, bool mirror, bool sparse) :
+    Renderer(EInkDisplay::Config(width, height), rotation, mirror, sparse) { }
+
+// 90 and 270 degree rotations swap the axes of the drawing surface
+Renderer::Renderer(const EInkConfig &config, Rotation rotation, bool mirror, bool sparse) :
+    tilePool(BinaryMatrix::tileBytes(rotation % 2 ? config.height : config.width)),
+    redData(rotation % 2 ? config.height : config.width, rotation % 2 ? config.width : config.height, sparse ? &tilePool : nullptr),
+    blackData(rotation % 2 ? config.height : config.width, rotation % 2 ? config.width : config.height, sparse ? &tilePool : nullptr),
+    display(config) {
+
+    display.setOrientation(Orientation(rotation, mirror));
+
+    resetClipRect();
     clearBounds();
+    EINK_STAT(_stats.reset());
+    EINK_STAT(_frameStats.reset());
 
     display.setup();
 }
 
+int Renderer::getWidth() const {
+    return blackData.width;
+}
+
+int Renderer::getHeight() const {
+    return blackData.height;
+}
+
+const TilePool &Renderer::getTilePool() const {
+    return tilePool;
+}
+
+EInkDisplay &Renderer::getDisplay() {
+    return display;
+}
+
 void Renderer::drawRect(int x, int y, int width, int height) {
+    EINK_STAT(PrimitiveTimer timer(_stats, _trace, STAT_RECT));
+
     updateBounds(x, y, x + width, y + height);
 
-    data().setRect(x, y, width, borderWidth, pixelValue);                         // top border
-    data().setRect(x, y + height - borderWidth, width, borderWidth, pixelValue);  // bottom border
+    setRect(Rect(x, y, width, borderWidth));                          // top border
+    setRect(Rect(x, y + height - borderWidth, width, borderWidth));   // bottom border
 
-    data().setRect(x, y, borderWidth, height, pixelValue);                        // left border
-    data().setRect(x + width - borderWidth, y, borderWidth, height, pixelValue);  // right border
+    setRect(Rect(x, y, borderWidth, height));                         // left border
+    setRect(Rect(x + width - borderWidth, y, borderWidth, height));   // right border
 }
 
 void Renderer::fillRect(int x, int y, int width, int height) {
+    EINK_STAT(PrimitiveTimer timer(_stats, _trace, STAT_FILL_RECT));
+
     updateBounds(x, y, x + width, y + height);
 
-    data().setRect(x, y, width, height, pixelValue);
+    if (solidFill) {
+        setRect(Rect(x, y, width, height));
+        return;
+    }
+
+    for (int row = y; row < y + height; row++) {
+        fillSpan(row, x, x + width);
+    }
 }
 
 void Renderer::fillRoundRect(int x, int y, int width, int height, int radius) {
+    EINK_STAT(PrimitiveTimer timer(_stats, _trace, STAT_ROUND_RECT));
+
     int a = (width / 2) - radius;
     int b = (height / 2) - radius;
+    const int centerX = x + width / 2;
 
+    // A pixel is inside when max(|dx| - a, 0)^2 + max(|dy| - b, 0)^2 <= radius^2, so each row is
+    // one span of |dx| <= a + sqrt(radius^2 - max(|dy| - b, 0)^2)
     for (int row = y; row <= y + height; row++) {
-        for (int col = x; col <= x + width; col++) {
-            int cx = max(abs(col - (x + width/2)) - a, 0);
-            int cy = max(abs(row - (y + height/2)) - b, 0);
-            if (cx * cx + cy * cy <= radius * radius) {
-                data().setPixel(col, row, pixelValue);
-            }
-        }
+        int cy = max(abs(row - (y + height/2)) - b, 0);
+        if (cy > radius) continue;
+
+        int half = a + (int) sqrtf(radius * radius - cy * cy);
+        fillSpan(row, max(centerX - half, x), min(centerX + half, x + width) + 1);
     }
 
-    updateBounds(x, y, x + width * 2, y + height * 2);;
+    updateBounds(x, y, x + width + 1, y + height + 1);
 }
 
 void Renderer::fillCircle(int centerX, int centerY, int radius) {
+    EINK_STAT(PrimitiveTimer timer(_stats, _trace, STAT_CIRCLE));
+
     for (int y = centerY - radius; y <= centerY + radius; y++) {
-        for (int x = centerX - radius; x <= centerX + radius; x++) {
-            float cx = x - centerX;
-            float cy = y - centerY;
-            if (cx * cx + cy * cy <= radius * radius) {
-                data().setPixel(x, y, pixelValue);
-            }
-        }
+        int cy = y - centerY;
+        int half = (int) sqrtf(radius * radius - cy * cy);
+        fillSpan(y, centerX - half, centerX + half + 1);
     }
 
-    updateBounds(centerX - radius, centerY - radius, centerX + radius, centerY + radius);
+    updateBounds(centerX - radius, centerY - radius, centerX + radius + 1, centerY + radius + 1);
 }
 
 void Renderer::drawLine(int x1, int y1, int x2, int y2) {
+    EINK_STAT(PrimitiveTimer timer(_stats, _trace, STAT_LINE));
+
     // Find equation for y
     float m = ((float) (y2 - y1)) / ((float) (x2 - x1));
 
@@ -70,7 +112,7 @@ void Renderer::drawLine(int x1, int y1, int x2, int y2) {
     for (int x = startX; x <= endX; x++) {
         int y = m * (x - x1) + y1;
 
-        data().setPixel(x, y, pixelValue);
+        plot(x, y, pixelValue);
     }
 
     // Draw by giving input y
@@ -79,29 +121,146 @@ void Renderer::drawLine(int x1, int y1, int x2, int y2) {
     for (int y = startY; y <= endY; y++) {
         int x = (float) (y - y1) / m + x1;
 
-        data().setPixel(x, y, pixelValue);
+        plot(x, y, pixelValue);
     }
 
-    updateBounds(x1, y1, x2, y2);
+    updateBounds(min(x1, x2), min(y1, y2), max(x1, x2) + 1, max(y1, y2) + 1);
+}
+
+void Renderer::fillPolygon(const Point *points, int count, FillRule rule) {
+    const uint16_t size = count;
+    fillPolygon(points, &size, 1, rule);
+}
+
+void Renderer::fillPolygon(const Point *points, const uint16_t *contourSizes, int contours, FillRule rule) {
+    EINK_STAT(PrimitiveTimer timer(_stats, _trace, STAT_POLYGON));
+
+    scanPolygon(points, contourSizes, contours, rule, clip, fillSpanSink, this);
+
+    int total = 0;
+    for (int c = 0; c < contours; c++) total += contourSizes[c];
+    updatePolygonBounds(points, total);
+}
+
+void Renderer::fillTriangle(int x0, int y0, int x1, int y1, int x2, int y2) {
+    const Point points[] = { { (int16_t) x0, (int16_t) y0 }, { (int16_t) x1, (int16_t) y1 }, { (int16_t) x2, (int16_t) y2 } };
+    fillPolygon(points, 3);
+}
+
+void Renderer::fillArc(int centerX, int centerY, int innerRadius, int outerRadius, float startAngle, float endAngle) {
+    Point points[200];
+    const int count = arcPoints(centerX, centerY, innerRadius, outerRadius, startAngle, endAngle, points, 200);
+    if (count > 0) fillPolygon(points, count);
+}
+
+void Renderer::fillPie(int centerX, int centerY, int radius, float startAngle, float endAngle) {
+    fillArc(centerX, centerY, 0, radius, startAngle, endAngle);
+}
+
+void Renderer::fillAreaUnder(const Point *points, int count, int baseY) {
+    if (count < 2) return;
+
+    Point *area = (Point*) malloc((count + 2) * sizeof(Point));
+    if (area == nullptr) {
+        Serial.println("Error: not enough memory to fill area");
+        return;
+    }
+
+    memcpy(area, points, count * sizeof(Point));
+    area[count] = { points[count - 1].x, (int16_t) baseY };
+    area[count + 1] = { points[0].x, (int16_t) baseY };
+    fillPolygon(area, count + 2);
+
+    free(area);
 }
 
 void Renderer::drawImage(Image &image, int x, int y) {
-    for (int r = 0; r < image.height * image.getScale(); r++) {
-        for (int c = 0; c < image.width * image.getScale(); c++) {
+    EINK_STAT(PrimitiveTimer timer(_stats, _trace, STAT_IMAGE));
+
+    // Only the pixels inside the clip are looked up
+    const Rect area = Rect(x, y, image.width * image.getScale(), image.height * image.getScale()).intersect(clip);
+
+    for (int r = area.y - y; r < area.y + area.height - y; r++) {
+        for (int c = area.x - x; c < area.x + area.width - x; c++) {
             Pixel p = image.pixelAt(c, r);
             data().setPixel(x + c, y + r, (p.b <= 1) & pixelValue);
         }
     }
 
-    updateBounds(x, y, x + image.width, x + image.height);
+    updateBounds(x, y, x + image.width * image.getScale(), y + image.height * image.getScale());
+}
+
+bool Renderer::drawImage(ByteSource &source, int x, int y, Dither dither, uint8_t threshold) {
+    EINK_STAT(PrimitiveTimer timer(_stats, _trace, STAT_IMAGE));
+
+    ImageDecoder decoder(source, dither, threshold);
+    if (!decoder.begin()) return false;
+
+    const ImageInfo &info = decoder.info();
+    const BinaryMatrix *row;
+    int rowY;
+    while ((row = decoder.nextRow(rowY)) != nullptr) {
+        // Like drawImage(Image), every pixel is written: ink as the pixel value, paper as 0
+        if (pixelValue) {
+            blitClipped(*row, nullptr, Rect(0, 0, info.width, 1), x, y + rowY, ROP_COPY);
+        } else {
+            setRect(Rect(x, y + rowY, info.width, 1));
+        }
+    }
+
+    updateBounds(x, y, x + info.width, y + info.height);
+    return !decoder.failed();
+}
+
+void Renderer::blit(const BinaryMatrix &src, Rect srcRect, int x, int y, RasterOp rop) {
+    EINK_STAT(PrimitiveTimer timer(_stats, _trace, STAT_BLIT));
+
+    blitClipped(src, nullptr, srcRect, x, y, rop);
+
+    updateBounds(x, y, x + srcRect.width, y + srcRect.height);
+}
+
+void Renderer::blitMasked(const BinaryMatrix &src, const BinaryMatrix &mask, Rect srcRect, int x, int y) {
+    EINK_STAT(PrimitiveTimer timer(_stats, _trace, STAT_BLIT));
+
+    blitClipped(src, &mask, srcRect, x, y, ROP_COPY);
+
+    updateBounds(x, y, x + srcRect.width, y + srcRect.height);
+}
+
+Rect Renderer::scroll(Rect rect, int dx, int dy) {
+    EINK_STAT(PrimitiveTimer timer(_stats, _trace, STAT_BLIT));
+
+    rect = rect.intersect(clip);
+    if (rect.isEmpty() || (dx == 0 && dy == 0)) return Rect();
+
+    blackData.scroll(rect, dx, dy, pixelValue && color == DisplayColor::BLACK);
+    redData.scroll(rect, dx, dy, pixelValue && color == DisplayColor::RED);
+
+    updateBounds(rect.x, rect.y, rect.x + rect.width, rect.y + rect.height);
+
+    // Bounds of the uncovered rows and columns
+    Rect exposed;
+    if (dy != 0) {
+        exposed = Rect(rect.x, dy > 0 ? rect.y : rect.y + rect.height + dy, rect.width, abs(dy));
+    }
+    if (dx != 0) {
+        exposed = exposed.unite(Rect(dx > 0 ? rect.x : rect.x + rect.width + dx, rect.y, abs(dx), rect.height));
+    }
+    return exposed.intersect(rect);
 }
 
 void Renderer::drawText(int x, int y, const char *text, TextAlignment align) {
+    EINK_STAT(PrimitiveTimer timer(_stats, _trace, STAT_TEXT));
+
     if (font == nullptr) {
         Serial.println("Error: font not set");
         return;
     }
 
+    const TextCache::Text *cached = textCache != nullptr ? textCache->get(*font, text) : nullptr;
+    const TextExtent extent = cached != nullptr ? cached->extent : measureText(*font, text);
+
     int startX;
 
     switch(align) {
@@ -109,46 +268,23 @@ void Renderer::drawText(int x, int y, const char *text, TextAlignment align) {
             startX = x;
             break;
         case TextAlignment::CENTER:
-            startX = x - font->computeWidth(text)/2;
+            startX = x - extent.width/2;
             break;
         case TextAlignment::RIGHT:
-            startX = x - font->computeWidth(text);
+            startX = x - extent.width;
             break;
     }
 
-    int textX = startX;
-    int maxHeight = 0;
-
-    int len = String(text).length();
-    for (int i = 0; i < len; i++) {
-        FontChar c = font->getCharacter(text[i]);
-        maxHeight = max((int) c.height + c.yoffset, maxHeight);
-
-        // Apply kerning
-        int kerning = 0;
-        if (i >= 1) {
-            kerning = font->getKerning(text[i-1], text[i]);
-        }
-        textX += kerning;
-
-        for (int oy = 0; oy < c.height; oy++) {
-            for (int ox = 0; ox < c.width; ox++) {
-                Pixel p = font->getPixel(c.x + ox, c.y + oy);
-                bool active = p.b <= 1;
-
-                int outputX = textX + ox;
-                int outputY = y + oy;
-
-                if (active) {
-                    data().setPixel(outputX + c.xoffset, outputY + c.yoffset, active & pixelValue);
-                }
-            }
-        }
-
-        textX += c.xadvance;
+    if (cached != nullptr) {
+        const BinaryMatrix &bitmap = *cached->bitmap;
+        blitClipped(bitmap, nullptr, Rect(0, 0, bitmap.width, bitmap.height), startX + extent.minX, y + extent.minY,
+            pixelValue ? ROP_OR : ROP_AND_NOT);
+    } else {
+        rasterizeText(*font, text, data(), startX, y, pixelValue, clip);
     }
 
-    updateBounds(startX, y, textX, y + maxHeight);
+    updateBounds(startX + min(extent.minX, 0), y + min(extent.minY, 0),
+        startX + max(extent.maxX, extent.advance), y + max(extent.maxY, extent.height));
 }
 
 void Renderer::setFont(Font *font) {
@@ -159,17 +295,50 @@ Font *Renderer::getFont() const {
     return this->font;
 }
 
+void Renderer::setTextCache(TextCache *cache) {
+    textCache = cache;
+}
+
 void Renderer::setColor(DisplayColor color) {
     this->color = color;
 }
 
+void Renderer::setFillPattern(const FillPattern &pattern) {
+    fillPattern = pattern;
+    solidFill = pattern.isSolid();
+}
+
 void Renderer::clearAll() {
     blackData.clear();
     redData.clear();
+    dirtyRegion.add(screen());
     dirty = true;
+    panelRamValid = false;
     // display.clear();
 }
 
+int Renderer::drain(DrawQueue &queue, int maxCommands) {
+    const DisplayColor savedColor = color;
+    const bool savedPixelValue = pixelValue;
+    Font *savedFont = font;
+    const Rect savedClip = clip;
+    const FillPattern savedPattern = fillPattern;
+
+    DrawCommand command;
+    int executed = 0;
+    while (executed < maxCommands && queue.pop(command)) {
+        execute(command);
+        executed++;
+    }
+
+    color = savedColor;
+    pixelValue = savedPixelValue;
+    font = savedFont;
+    clip = savedClip;
+    setFillPattern(savedPattern);
+    return executed;
+}
+
 void Renderer::setDrawMode() {
     pixelValue = true;
 }
@@ -184,42 +353,228 @@ void Renderer::begin() {
 
 void Renderer::end() {
     display.sleep();
+    panelRamValid = false; // deep sleep does not keep the RAM
 }
 
 void Renderer::render() {
-    if (!dirty) return;
+    EINK_STAT(const uint32_t frameStart = micros());
+    if (!transferFrame()) return;
+
+    display.apply();
+
+    EINK_STAT(finishFrameStats(frameStart));
+    clearBounds();
+}
+
+void Renderer::renderAsync() {
+    EINK_STAT(const uint32_t frameStart = micros());
+    if (!transferFrame()) return;
+
+    // The frame stats of an async frame end when the refresh starts
+    display.applyAsync();
+
+    EINK_STAT(finishFrameStats(frameStart));
+    clearBounds();
+}
+
+bool Renderer::isBusy() {
+    return display.isBusy();
+}
+
+void Renderer::waitIdle() {
+    display.waitIdle();
+}
+
+bool Renderer::isDirty() const {
+    return dirty;
+}
+
+bool Renderer::transferFrame() {
+    if (!dirty) return false;
     dirty = false;
 
-    // TODO: clamp value within screen
-    int x = _minX;
-    int y = _minY;
-    int width = _maxX - _minX;
-    int height = _maxY - _minY;
+    // A refresh still running holds the stats of the previous frame
+    display.waitIdle();
+    EINK_STAT(display.resetStats());
+
+    if (partialTransfer && panelRamValid) {
+        for (int i = 0; i < dirtyRegion.count(); i++) {
+            const Rect &rect = dirtyRegion[i];
+            display.writePartial(blackData, rect.x, rect.y, rect.width, rect.height, true);
+            display.writePartial(redData, rect.x, rect.y, rect.width, rect.height, false);
+        }
+    } else {
+        display.writeBuffer(blackData, true);
+        display.writeBuffer(redData, false);
+    }
+    panelRamValid = true;
+    return true;
+}
 
-    // display.writePartial(blackData.buffer, x, y, width, height, true);
-    // display.writePartial(redData.buffer, x, y, width, height, false);
-    display.writeBuffer(blackData.buffer, true);
-    display.writeBuffer(redData.buffer, false);
+void Renderer::setPartialTransfer(bool enabled) {
+    partialTransfer = enabled;
+}
 
-    display.apply();
+void Renderer::setClipRect(Rect rect) {
+    clip = rect.intersect(screen());
+}
+
+void Renderer::resetClipRect() {
+    clip = screen();
+}
+
+Rect Renderer::getClipRect() const {
+    return clip;
+}
+
+void Renderer::invalidate(Rect rect) {
+    updateBounds(rect.x, rect.y, rect.x + rect.width, rect.y + rect.height);
+}
+
+const DirtyRegion &Renderer::getDirtyRegion() const {
+    return dirtyRegion;
+}
+
+bool Renderer::saveSnapshot(ByteSink &sink, SnapshotStats *stats) const {
+    return ::saveSnapshot(blackData, redData, sink, stats);
+}
 
+bool Renderer::restoreSnapshot(ByteSource &source, SnapshotStats *stats) {
+    const bool ok = loadSnapshot(blackData, redData, source, stats);
+
+    // The panel still shows the snapshot, so nothing is dirty. The controller RAM did not survive
+    // deep sleep though: the next render() sends the full planes, the ones after that are partial.
+    panelRamValid = false;
     clearBounds();
+    dirty = !ok;
+    if (!ok) dirtyRegion.add(screen());
+    return ok;
+}
+
+bool Renderer::applyDelta(DeltaDecoder &decoder, ByteSource &source, DeltaStats *stats) {
+    DirtyRegion touched;
+    const bool ok = decoder.apply(blackData, redData, source, &touched, stats);
+
+    for (int i = 0; i < touched.count(); i++) {
+        dirtyRegion.add(touched[i]);
+    }
+    dirty = dirty || !touched.isEmpty();
+    return ok;
+}
+
+#if EINK_STATS
+const RenderStats &Renderer::getFrameStats() const {
+    return _frameStats;
+}
+
+void Renderer::setTraceSink(TraceSink sink) {
+    _trace = sink;
+    display.setTraceSink(sink);
+}
+
+void Renderer::finishFrameStats(uint32_t frameStart) {
+    _stats.pixelsWritten = blackData.pixelWrites + redData.pixelWrites;
+    _stats.spansWritten = blackData.spanWrites + redData.spanWrites;
+    blackData.pixelWrites = redData.pixelWrites = 0;
+    blackData.spanWrites = redData.spanWrites = 0;
+
+    _stats.dirtyArea = dirtyRegion.area();
+
+    _stats.display = display.stats();
+    _stats.frameMicros = micros() - frameStart;
+    emitTrace(_trace, TRACE_FRAME, 0, _stats.frameMicros);
+
+    _frameStats = _stats;
+    _stats.reset();
+}
+#endif
+
+void Renderer::execute(const DrawCommand &command) {
+    const int16_t *a = command.args;
+
+    color = command.color;
+    pixelValue = !command.clear;
+    font = command.font;
+    clip = command.clip.isEmpty() ? screen() : command.clip.intersect(screen());
+    setFillPattern(command.pattern);
+
+    switch (command.op) {
+        case DRAW_RECT: drawRect(a[0], a[1], a[2], a[3]); break;
+        case DRAW_FILL_RECT: fillRect(a[0], a[1], a[2], a[3]); break;
+        case DRAW_ROUND_RECT: fillRoundRect(a[0], a[1], a[2], a[3], a[4]); break;
+        case DRAW_CIRCLE: fillCircle(a[0], a[1], a[2]); break;
+        case DRAW_LINE: drawLine(a[0], a[1], a[2], a[3]); break;
+        case DRAW_TRIANGLE: fillTriangle(a[0], a[1], a[2], a[3], a[4], a[5]); break;
+        case DRAW_TEXT: drawText(a[0], a[1], command.text, command.align); break;
+        case DRAW_INVALIDATE: invalidate(Rect(a[0], a[1], a[2], a[3])); break;
+        default: Serial.println("Error: unknown draw command");
+    }
+}
+
+void Renderer::plot(int x, int y, bool value) {
+    if (x < clip.x || x >= clip.x + clip.width || y < clip.y || y >= clip.y + clip.height) return;
+
+    data().setPixel(x, y, value);
+}
+
+void Renderer::setRect(Rect rect) {
+    rect = rect.intersect(clip);
+    if (!rect.isEmpty()) data().setRect(rect.x, rect.y, rect.width, rect.height, pixelValue);
+}
+
+void Renderer::blitClipped(const BinaryMatrix &src, const BinaryMatrix *mask, Rect srcRect, int x, int y, RasterOp rop) {
+    // Move the source rect along with the destination rect when it is clipped
+    const Rect dst = Rect(x, y, srcRect.width, srcRect.height).intersect(clip);
+    if (dst.isEmpty()) return;
+
+    srcRect = Rect(srcRect.x + dst.x - x, srcRect.y + dst.y - y, dst.width, dst.height);
+    if (mask != nullptr) {
+        ::blitMasked(src, *mask, srcRect, data(), dst.x, dst.y);
+    } else {
+        ::blit(src, srcRect, data(), dst.x, dst.y, rop);
+    }
+}
+
+void Renderer::fillSpan(int y, int x0, int x1) {
+    if (y < clip.y || y >= clip.y + clip.height) return;
+
+    x0 = max(x0, clip.x);
+    x1 = min(x1, clip.x + clip.width);
+    if (x0 < x1) data().fillSpan(y, x0, x1, pixelValue, fillPattern.row(y));
+}
+
+void Renderer::fillSpanSink(void *context, int y, int x0, int x1) {
+    ((Renderer*) context)->fillSpan(y, x0, x1);
+}
+
+void Renderer::updatePolygonBounds(const Point *points, int count) {
+    if (count == 0) return;
+
+    int minX = points[0].x, minY = points[0].y;
+    int maxX = minX, maxY = minY;
+    for (int i = 1; i < count; i++) {
+        minX = min(minX, (int) points[i].x);
+        minY = min(minY, (int) points[i].y);
+        maxX = max(maxX, (int) points[i].x);
+        maxY = max(maxY, (int) points[i].y);
+    }
+    updateBounds(minX, minY, maxX, maxY);
+}
+
+Rect Renderer::screen() const {
+    return Rect(0, 0, blackData.width, blackData.height);
 }
 
 void Renderer::updateBounds(int minX, int minY, int maxX, int maxY) {
-    _minX = min(minX, _minX);
-    _minY = min(minY, _minY);
-    _maxX = max(maxX, _maxX);
-    _maxY = max(maxY, _maxY);
+    const Rect changed = Rect(minX, minY, maxX - minX, maxY - minY).intersect(clip);
+    if (changed.isEmpty()) return;
+
+    dirtyRegion.add(changed);
     dirty = true;
 }
 
 void Renderer::clearBounds() {
-    _minX = INT_MAX;
-    _minY = INT_MAX;
-    _maxX = 0;
-    _maxY = 0;
-
+    dirtyRegion.clear();
 }
 
 BinaryMatrix &Renderer::data() {
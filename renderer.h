@@ -1,11 +1,20 @@
 #ifndef renderer_h
 #define renderer_h
 
+#include "dirty_region.h"
 #include "eink_display.h"
+#include "fill_pattern.h"
 #include "binary_matrix.h"
 #include "image.h"
+#include "orientation.h"
+#include "polygon.h"
 
 #include "font.h"
+#include "frame_delta.h"
+#include "render_stats.h"
+#include "snapshot.h"
+#include "stream_image.h"
+#include "text_cache.h"
 
 enum DisplayColor {
     BLACK, RED
@@ -15,8 +24,12 @@ enum TextAlignment {
     LEFT, CENTER, RIGHT
 };
 
+struct DrawCommand;
+class DrawQueue;
+
 class Renderer {
 
+    TilePool tilePool; // tiles of both planes when they are sparse
     BinaryMatrix redData;
     BinaryMatrix blackData;
     EInkDisplay display;
@@ -25,18 +38,41 @@ class Renderer {
     int borderWidth = 1;
 
     Font *font = nullptr;
+    TextCache *textCache = nullptr;
 
-    // Bounds of rendering
-    int _minX;
-    int _minY;
-    int _maxX;
-    int _maxY;
+    // Areas changed since the last render(), within the screen
+    DirtyRegion dirtyRegion;
     bool dirty = false;
 
+    // Drawing only changes pixels inside the clip rect
+    Rect clip;
+
+    bool partialTransfer = false;
+    bool panelRamValid = false; // the controller RAM holds the planes, except for the dirty bounds
+
     bool pixelValue = true;
 
+    FillPattern fillPattern;
+    bool solidFill = true;
+
+#if EINK_STATS
+    RenderStats _stats;         // frame being drawn
+    RenderStats _frameStats;    // last rendered frame
+    TraceSink _trace = nullptr;
+#endif
+
 public:
-    Renderer(int width, int height);
+    // width and height are the panel size; drawing coordinates follow the rotation
+    // Sparse planes only allocate memory for the parts of the screen that are not blank.
+    Renderer(int width, int height, Rotation rotation = ROTATE_0, bool mirror = false, bool sparse = false);
+    // Panel on its own pins, e.g. one of several panels sharing the SPI bus
+    Renderer(const EInkConfig &config, Rotation rotation = ROTATE_0, bool mirror = false, bool sparse = false);
+
+    int getWidth() const;
+    int getHeight() const;
+
+    const TilePool &getTilePool() const;
+    EInkDisplay &getDisplay();
 
     void drawRect(int x, int y, int width, int height);
     void fillRect(int x, int y, int width, int height);
@@ -48,28 +84,123 @@ public:
 
     void drawLine(int x1, int y1, int x2, int y2);
 
+    // Filled with horizontal spans, see scanPolygon(). With the default rule a hole must wind
+    // against its outer contour; FILL_EVEN_ODD cuts out nested contours of either direction.
+    void fillPolygon(const Point *points, int count, FillRule rule = FILL_NON_ZERO);
+    void fillPolygon(const Point *points, const uint16_t *contourSizes, int contours, FillRule rule = FILL_NON_ZERO);
+    void fillTriangle(int x0, int y0, int x1, int y1, int x2, int y2);
+
+    // Angles are in degrees, clockwise from 3 o'clock
+    void fillArc(int centerX, int centerY, int innerRadius, int outerRadius, float startAngle, float endAngle);
+    void fillPie(int centerX, int centerY, int radius, float startAngle, float endAngle);
+
+    // Area between a polyline and the row baseY, e.g. a chart series
+    void fillAreaUnder(const Point *points, int count, int baseY);
+
     void drawImage(Image &image, int x, int y);
 
+    // Decodes a PBM, PGM, BMP or RLE image row by row straight into the current color plane.
+    // Returns false if the image could not be decoded; the rows before the error are drawn.
+    bool drawImage(ByteSource &source, int x, int y, Dither dither = DITHER_THRESHOLD, uint8_t threshold = 128);
+
+    // Copies pixels of an off-screen matrix into the current color plane
+    void blit(const BinaryMatrix &src, Rect srcRect, int x, int y, RasterOp rop = ROP_COPY);
+    void blitMasked(const BinaryMatrix &src, const BinaryMatrix &mask, Rect srcRect, int x, int y);
+
+    /**
+     * Moves the pixels inside rect by (dx, dy) in both planes, e.g. to advance a ticker or a
+     * rolling chart. The uncovered strips are cleared, or set in the current color in draw mode.
+     * The whole rect becomes dirty; the returned rect bounds the uncovered strips, which is where
+     * new content goes.
+     */
+    Rect scroll(Rect rect, int dx, int dy);
+
     void drawText(int x, int y, const char *text, TextAlignment align = TextAlignment::LEFT);
     void setFont(Font *font);
     Font *getFont() const;
 
+    // Texts drawn while a cache is set are rendered once and blitted afterwards
+    void setTextCache(TextCache *cache);
+
     void setColor(DisplayColor color);
 
+    // Pattern of fillRect, fillRoundRect, fillCircle and the polygon fills, e.g. FillPattern::gray(32)
+    void setFillPattern(const FillPattern &pattern);
+
     void clearAll();
     void render();
 
+    // Sends the frame and starts the refresh without waiting for it to finish. Drawing may
+    // continue meanwhile; the next transfer waits until the panel is idle.
+    void renderAsync();
+    bool isBusy();
+    void waitIdle();
+
+    // True if something changed since the last render
+    bool isDirty() const;
+
+    // Sends only the dirty bounds to the panel when the controller still holds the rest
+    void setPartialTransfer(bool enabled);
+
+    // Limits drawing to rect until the clip is reset to the whole screen
+    void setClipRect(Rect rect);
+    void resetClipRect();
+    Rect getClipRect() const;
+
+    // Marks an area as changed, e.g. to send it again on the next render()
+    void invalidate(Rect rect);
+    const DirtyRegion &getDirtyRegion() const;
+
+    // Compressed copy of both planes, e.g. to restore the frame after deep sleep without redrawing
+    bool saveSnapshot(ByteSink &sink, SnapshotStats *stats = nullptr) const;
+    bool restoreSnapshot(ByteSource &source, SnapshotStats *stats = nullptr);
+
+    // Applies a frame delta (frame_delta.h) to the planes and marks the rects it wrote dirty
+    bool applyDelta(DeltaDecoder &decoder, ByteSource &source, DeltaStats *stats = nullptr);
+
+    /**
+     * Executes up to maxCommands commands of queue, each with its own color, mode, font, fill
+     * pattern and clip; the renderer's own settings are restored afterwards. Call it from the
+     * task that renders. Returns the number of commands executed.
+     */
+    int drain(DrawQueue &queue, int maxCommands = 64);
+
     void setDrawMode();
     void setClearMode();
 
     void begin();
     void end();
 
+#if EINK_STATS
+    // Statistics of the last render() call, covering every draw call since the previous one
+    const RenderStats &getFrameStats() const;
+    void setTraceSink(TraceSink sink);
+#endif
+
 private:
     void updateBounds(int minX, int minY, int maxX, int maxY);
     void clearBounds();
 
     BinaryMatrix &data();
+
+    // Sends the dirty parts of the planes; false if nothing changed
+    bool transferFrame();
+
+    // Drawing helpers, clipped to the clip rect
+    void execute(const DrawCommand &command);
+    void plot(int x, int y, bool value);
+    void setRect(Rect rect);
+    void blitClipped(const BinaryMatrix &src, const BinaryMatrix *mask, Rect srcRect, int x, int y, RasterOp rop);
+
+    // Fills pixels [x0, x1) of row y with the fill pattern
+    void fillSpan(int y, int x0, int x1);
+    static void fillSpanSink(void *context, int y, int x0, int x1);
+    void updatePolygonBounds(const Point *points, int count);
+    Rect screen() const;
+
+#if EINK_STATS
+    void finishFrameStats(uint32_t frameStart);
+#endif
 };
 
 
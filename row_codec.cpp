@@ -0,0 +1,83 @@
+#include "row_codec.h"
+
+// Shorter repeats are cheaper as part of a literal
+static const int MIN_RUN = 3;
+
+static int putVarint(uint8_t *out, uint32_t value) {
+    int n = 0;
+    while (value >= 0x80) {
+        out[n++] = (value & 0x7F) | 0x80;
+        value >>= 7;
+    }
+    out[n++] = value;
+    return n;
+}
+
+static bool getVarint(ByteSource &source, uint32_t &value) {
+    value = 0;
+    for (int shift = 0; shift < 32; shift += 7) {
+        uint8_t b;
+        if (!source.read(&b, 1)) return false;
+
+        value |= (uint32_t) (b & 0x7F) << shift;
+        if ((b & 0x80) == 0) return true;
+    }
+    return false;
+}
+
+int encodeRleRow(const uint8_t *row, int length, uint8_t *out) {
+    int n = 0;
+    int literalStart = 0;
+    int i = 0;
+
+    while (i < length) {
+        int run = 1;
+        while (i + run < length && row[i + run] == row[i]) run++;
+
+        if (run < MIN_RUN) {
+            i += run;
+            continue;
+        }
+
+        if (literalStart < i) {
+            n += putVarint(out + n, (i - literalStart) << 1);
+            memcpy(out + n, row + literalStart, i - literalStart);
+            n += i - literalStart;
+        }
+
+        n += putVarint(out + n, (run << 1) | 1);
+        out[n++] = row[i];
+
+        i += run;
+        literalStart = i;
+    }
+
+    if (literalStart < length) {
+        n += putVarint(out + n, (length - literalStart) << 1);
+        memcpy(out + n, row + literalStart, length - literalStart);
+        n += length - literalStart;
+    }
+
+    return n;
+}
+
+bool decodeRleRow(ByteSource &source, uint8_t *row, int length) {
+    int i = 0;
+    while (i < length) {
+        uint32_t token;
+        if (!getVarint(source, token)) return false;
+
+        const uint32_t count = token >> 1;
+        if (count == 0 || count > (uint32_t) (length - i)) return false;
+
+        if (token & 1) {
+            uint8_t value;
+            if (!source.read(&value, 1)) return false;
+            memset(row + i, value, count);
+        } else if (!source.read(row + i, count)) {
+            return false;
+        }
+        i += count;
+    }
+    return true;
+}
@@ -0,0 +1,22 @@
+#ifndef row_codec_h
+#define row_codec_h
+
+#include <Arduino.h>
+
+#include "byte_stream.h"
+
+/**
+ * Run-length coding of byte rows, shared by snapshots and RLE images. A row is a sequence of
+ * tokens: a varint (count << 1 | 1) followed by one byte repeated count times, or a varint
+ * (count << 1) followed by count literal bytes. Rows are usually XORed with the previous row
+ * first, which turns unchanged areas into runs of zero.
+ */
+
+// Encodes length bytes of row into out, which must hold 2 * length + 8 bytes. Returns the
+// encoded size.
+int encodeRleRow(const uint8_t *row, int length, uint8_t *out);
+
+// Decodes exactly length bytes into row; false on a read error or invalid data
+bool decodeRleRow(ByteSource &source, uint8_t *row, int length);
+
+#endif
@@ -0,0 +1,169 @@
+#include "snapshot.h"
+
+#include "row_codec.h"
+
+static const uint8_t SNAPSHOT_MAGIC[4] = { 'E', 'S', 'N', 'P' };
+static const uint8_t SNAPSHOT_VERSION = 1;
+static const int SNAPSHOT_HEADER_BYTES = 12;
+
+// FNV-1a over the raw rows
+static uint32_t checksum(uint32_t hash, const uint8_t *data, int length) {
+    for (int i = 0; i < length; i++) {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    return hash;
+}
+
+bool saveSnapshot(const BinaryMatrix &black, const BinaryMatrix &red, ByteSink &sink, SnapshotStats *stats) {
+    const uint32_t start = micros();
+
+    if (black.width != red.width || black.height != red.height) {
+        Serial.printf("Error: snapshot planes differ in size, (%d,%d) and (%d,%d)\n", black.width, black.height, red.width, red.height);
+        return false;
+    }
+
+    const int stride = black.stride;
+    uint8_t *delta = (uint8_t*) malloc(stride);
+    uint8_t *encoded = (uint8_t*) malloc(2 * stride + 8);
+    if (delta == nullptr || encoded == nullptr) {
+        Serial.println("Error: not enough memory to save snapshot");
+        free(delta);
+        free(encoded);
+        return false;
+    }
+
+    const uint8_t header[SNAPSHOT_HEADER_BYTES] = {
+        SNAPSHOT_MAGIC[0], SNAPSHOT_MAGIC[1], SNAPSHOT_MAGIC[2], SNAPSHOT_MAGIC[3],
+        SNAPSHOT_VERSION, 2,
+        (uint8_t) (black.width & 0xFF), (uint8_t) (black.width >> 8),
+        (uint8_t) (black.height & 0xFF), (uint8_t) (black.height >> 8),
+        0, 0
+    };
+
+    bool ok = sink.write(header, sizeof(header));
+    uint32_t written = sizeof(header);
+    uint32_t hash = 2166136261u;
+
+    const BinaryMatrix *planes[] = { &black, &red };
+    for (const BinaryMatrix *plane : planes) {
+        const uint8_t *previous = nullptr;
+
+        for (int y = 0; y < plane->height && ok; y++) {
+            const uint8_t *row = plane->rowData(y);
+            hash = checksum(hash, row, stride);
+
+            for (int i = 0; i < stride; i++) {
+                delta[i] = previous != nullptr ? row[i] ^ previous[i] : row[i];
+            }
+            previous = row;
+
+            const int n = encodeRleRow(delta, stride, encoded);
+            ok = sink.write(encoded, n);
+            written += n;
+        }
+    }
+
+    const uint8_t trailer[4] = { (uint8_t) hash, (uint8_t) (hash >> 8), (uint8_t) (hash >> 16), (uint8_t) (hash >> 24) };
+    ok = ok && sink.write(trailer, sizeof(trailer));
+    written += sizeof(trailer);
+
+    free(delta);
+    free(encoded);
+
+    if (!ok) {
+        Serial.println("Error: snapshot could not be written completely");
+        return false;
+    }
+
+    if (stats != nullptr) {
+        stats->rawBytes = 2 * (uint32_t) stride * black.height;
+        stats->encodedBytes = written;
+        stats->micros = micros() - start;
+    }
+    return true;
+}
+
+static bool decodePlanes(BinaryMatrix &black, BinaryMatrix &red, ByteSource &source, uint8_t *row, uint8_t *previous) {
+    uint8_t header[SNAPSHOT_HEADER_BYTES];
+    if (!source.read(header, sizeof(header))) return false;
+
+    if (memcmp(header, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0 || header[4] != SNAPSHOT_VERSION || header[5] != 2) {
+        Serial.println("Error: not a snapshot, or a snapshot of an unsupported version");
+        return false;
+    }
+
+    const uint16_t width = header[6] | (header[7] << 8);
+    const uint16_t height = header[8] | (header[9] << 8);
+    if (width != black.width || height != black.height || width != red.width || height != red.height) {
+        Serial.printf("Error: snapshot is of size (%d,%d), screen size is (%d,%d)\n", width, height, black.width, black.height);
+        return false;
+    }
+
+    const int stride = black.stride;
+    uint32_t hash = 2166136261u;
+
+    BinaryMatrix *planes[] = { &black, &red };
+    for (BinaryMatrix *plane : planes) {
+        plane->clear();
+        memset(previous, 0, stride);
+
+        for (int y = 0; y < plane->height; y++) {
+            if (!decodeRleRow(source, row, stride)) return false;
+
+            bool blank = true;
+            for (int i = 0; i < stride; i++) {
+                row[i] ^= previous[i];
+                blank = blank && row[i] == 0;
+            }
+            hash = checksum(hash, row, stride);
+
+            // Blank rows stay uniform in sparse planes
+            if (!blank) memcpy(plane->rowData(y), row, stride);
+
+            uint8_t *swap = previous;
+            previous = row;
+            row = swap;
+        }
+
+        plane->compact();
+    }
+
+    uint8_t trailer[4];
+    if (!source.read(trailer, sizeof(trailer))) return false;
+
+    const uint32_t expected = trailer[0] | (trailer[1] << 8) | ((uint32_t) trailer[2] << 16) | ((uint32_t) trailer[3] << 24);
+    if (expected != hash) {
+        Serial.println("Error: snapshot checksum does not match");
+        return false;
+    }
+    return true;
+}
+
+bool loadSnapshot(BinaryMatrix &black, BinaryMatrix &red, ByteSource &source, SnapshotStats *stats) {
+    const uint32_t start = micros();
+
+    // One row being decoded and the one above it, to undo the XOR
+    uint8_t *rows = (uint8_t*) malloc(2 * black.stride);
+    if (rows == nullptr) {
+        Serial.println("Error: not enough memory to load snapshot");
+        return false;
+    }
+
+    CountingSource counted(source);
+    const bool ok = decodePlanes(black, red, counted, rows, rows + black.stride);
+    free(rows);
+
+    if (!ok) {
+        Serial.println("Error: snapshot could not be read");
+        black.clear();
+        red.clear();
+        return false;
+    }
+
+    if (stats != nullptr) {
+        stats->rawBytes = 2 * (uint32_t) black.stride * black.height;
+        stats->encodedBytes = counted.count;
+        stats->micros = micros() - start;
+    }
+    return true;
+}
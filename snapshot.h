@@ -0,0 +1,29 @@
+#ifndef snapshot_h
+#define snapshot_h
+
+#include <Arduino.h>
+
+#include "binary_matrix.h"
+#include "byte_stream.h"
+
+/**
+ * Compressed snapshots of the black and red planes, so a frame can be kept in flash, RTC memory
+ * or a file and restored after deep sleep without redrawing it.
+ *
+ * Each row is XORed with the row above it and the result is run-length encoded. A token is a
+ * varint (length << 1 | isRun) followed by one byte for a run or length bytes for a literal.
+ * Tokens never cross a row. The header holds the size of the planes and a checksum of the raw
+ * planes follows the data, so a snapshot of another screen or a corrupted one is rejected.
+ */
+struct SnapshotStats {
+    uint32_t rawBytes;      // size of both planes
+    uint32_t encodedBytes;  // size of the snapshot, including header and checksum
+    uint32_t micros;        // time spent encoding or decoding
+};
+
+bool saveSnapshot(const BinaryMatrix &black, const BinaryMatrix &red, ByteSink &sink, SnapshotStats *stats = nullptr);
+
+// Both planes must have the size stored in the snapshot. They are cleared if it cannot be read.
+bool loadSnapshot(BinaryMatrix &black, BinaryMatrix &red, ByteSource &source, SnapshotStats *stats = nullptr);
+
+#endif
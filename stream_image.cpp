@@ -0,0 +1,365 @@
+#include "stream_image.h"
+
+#include "fill_pattern.h"
+#include "row_codec.h"
+
+static const uint8_t RLE_MAGIC[4] = { 'E', 'R', 'L', 'I' };
+
+static uint16_t getWord(const uint8_t *p) {
+    return p[0] | (p[1] << 8);
+}
+
+static uint32_t getDword(const uint8_t *p) {
+    return getWord(p) | ((uint32_t) getWord(p + 2) << 16);
+}
+
+static uint8_t luma(uint8_t r, uint8_t g, uint8_t b) {
+    return (r * 77 + g * 150 + b * 29) >> 8;
+}
+
+static bool isSpace(uint8_t c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+}
+
+ImageDecoder::ImageDecoder(ByteSource &source, Dither dither, uint8_t threshold) :
+    _source(source), _dither(dither), _threshold(threshold) {}
+
+ImageDecoder::~ImageDecoder() {
+    free(_raw);
+    free(_gray);
+    free(_error);
+    delete _row;
+}
+
+bool ImageDecoder::begin() {
+    uint8_t magic[2];
+    if (!read(magic, 2)) return fail("Error: image is empty");
+
+    bool ok;
+    if (magic[0] == 'P' && strchr("1245", magic[1]) != nullptr && magic[1] != 0) {
+        _pnmType = magic[1];
+        ok = beginPnm();
+    } else if (magic[0] == 'B' && magic[1] == 'M') {
+        ok = beginBmp();
+    } else if (magic[0] == RLE_MAGIC[0] && magic[1] == RLE_MAGIC[1]) {
+        ok = beginRle();
+    } else {
+        return fail("Error: unknown image format");
+    }
+    if (!ok) return false;
+
+    if (_info.width == 0 || _info.height == 0) return fail("Error: image has no pixels");
+
+    _raw = (uint8_t*) malloc(_rowBytes);
+    _gray = (uint8_t*) malloc(_info.width);
+    if (_dither == DITHER_DIFFUSION) {
+        _error = (int16_t*) calloc(2 * (_info.width + 2), sizeof(int16_t));
+    }
+    _row = new BinaryMatrix(_info.width, 1);
+
+    if (_raw == nullptr || _gray == nullptr || _row->buffer == nullptr
+            || (_dither == DITHER_DIFFUSION && _error == nullptr)) {
+        return fail("Error: not enough memory for image rows");
+    }
+
+    _row->clear();
+    return true;
+}
+
+const ImageInfo &ImageDecoder::info() const {
+    return _info;
+}
+
+const BinaryMatrix *ImageDecoder::nextRow(int &y) {
+    if (_failed || _row == nullptr || _rowsRead >= _info.height) return nullptr;
+
+    y = _bottomUp ? _info.height - 1 - _rowsRead : _rowsRead;
+
+    if (_info.format == IMAGE_RLE) {
+        // Rows are XORed with the previous one, which is still in _row
+        if (!decodeRleRow(_source, _raw, _rowBytes)) {
+            fail("Error: RLE image is truncated or corrupt");
+            return nullptr;
+        }
+
+        uint8_t *bits = _row->rowData(0);
+        for (uint32_t i = 0; i < _rowBytes; i++) {
+            bits[i] ^= _raw[i];
+        }
+    } else {
+        if (!readGrayRow()) {
+            fail("Error: image is truncated");
+            return nullptr;
+        }
+        convertRow(y);
+    }
+
+    _rowsRead++;
+    return _row;
+}
+
+bool ImageDecoder::failed() const {
+    return _failed;
+}
+
+bool ImageDecoder::read(uint8_t *data, uint32_t length) {
+    _position += length;
+    return _source.read(data, length);
+}
+
+bool ImageDecoder::skip(uint32_t length) {
+    uint8_t scratch[16];
+    while (length > 0) {
+        const uint32_t n = min(length, (uint32_t) sizeof(scratch));
+        if (!read(scratch, n)) return false;
+        length -= n;
+    }
+    return true;
+}
+
+bool ImageDecoder::fail(const char *message) {
+    Serial.println(message);
+    _failed = true;
+    return false;
+}
+
+bool ImageDecoder::beginPnm() {
+    _info.format = _pnmType == '1' || _pnmType == '4' ? IMAGE_PBM : IMAGE_PGM;
+
+    uint32_t width, height, maxValue = 1;
+    if (!readPnmNumber(width) || !readPnmNumber(height)) return fail("Error: invalid PNM header");
+    if (_info.format == IMAGE_PGM && !readPnmNumber(maxValue)) return fail("Error: invalid PNM header");
+
+    if (width > 0xFFFF || height > 0xFFFF) return fail("Error: image is too large");
+    if (maxValue == 0 || maxValue > 0xFFFF) return fail("Error: invalid PGM maximum value");
+
+    _info.width = width;
+    _info.height = height;
+    _maxValue = maxValue;
+
+    switch (_pnmType) {
+        case '4': _rowBytes = (width + 7) / 8; break;
+        case '5': _rowBytes = width * (maxValue > 255 ? 2 : 1); break;
+        default: _rowBytes = 1; break;     // plain formats are read a number at a time
+    }
+    return true;
+}
+
+bool ImageDecoder::beginBmp() {
+    _info.format = IMAGE_BMP;
+
+    // File header after the magic, and the fixed part of the info header
+    uint8_t header[12 + 40];
+    if (!read(header, sizeof(header))) return fail("Error: BMP header is truncated");
+
+    const uint32_t dataOffset = getDword(header + 8);
+    const uint32_t infoSize = getDword(header + 12);
+    const int32_t width = getDword(header + 16);
+    const int32_t height = getDword(header + 20);
+    _bitsPerPixel = getWord(header + 26);
+    const uint32_t compression = getDword(header + 28);
+    uint32_t colors = getDword(header + 44);
+
+    if (infoSize < 40) return fail("Error: BMP version is not supported");
+    if (compression != 0) return fail("Error: compressed BMP is not supported");
+    if (width <= 0 || width > 0xFFFF || height == 0 || height < -0xFFFF || height > 0xFFFF) return fail("Error: invalid BMP size");
+    if (!skip(infoSize - 40)) return fail("Error: BMP header is truncated");
+
+    switch (_bitsPerPixel) {
+        case 1: case 4: case 8: case 16: case 24: case 32: break;
+        default: return fail("Error: BMP bit depth is not supported");
+    }
+
+    if (_bitsPerPixel <= 8) {
+        if (colors == 0 || colors > (1u << _bitsPerPixel)) colors = 1 << _bitsPerPixel;
+        memset(_palette, 0, sizeof(_palette));
+        for (uint32_t i = 0; i < colors; i++) {
+            uint8_t entry[4];
+            if (!read(entry, 4)) return fail("Error: BMP palette is truncated");
+            _palette[i] = luma(entry[2], entry[1], entry[0]);
+        }
+    }
+
+    if (dataOffset < _position || !skip(dataOffset - _position)) return fail("Error: invalid BMP data offset");
+
+    _info.width = width;
+    _info.height = abs(height);
+    _bottomUp = height > 0;
+    _rowBytes = (width * _bitsPerPixel + 31) / 32 * 4;
+    return true;
+}
+
+bool ImageDecoder::beginRle() {
+    uint8_t header[6];
+    if (!read(header, sizeof(header))) return fail("Error: RLE header is truncated");
+    if (header[0] != RLE_MAGIC[2] || header[1] != RLE_MAGIC[3]) return fail("Error: unknown image format");
+
+    _info.format = IMAGE_RLE;
+    _info.width = getWord(header + 2);
+    _info.height = getWord(header + 4);
+    _rowBytes = (_info.width + 7) / 8;
+    return true;
+}
+
+// Skips whitespace and comments, then reads a decimal number and the whitespace byte after it
+bool ImageDecoder::readPnmNumber(uint32_t &value) {
+    uint8_t c;
+    do {
+        if (!read(&c, 1)) return false;
+        if (c == '#') {
+            while (c != '\n') {
+                if (!read(&c, 1)) return false;
+            }
+        }
+    } while (isSpace(c));
+
+    if (c < '0' || c > '9') return false;
+
+    value = 0;
+    while (c >= '0' && c <= '9') {
+        if (value > 0xFFFFFF) return false;
+        value = value * 10 + (c - '0');
+        if (!read(&c, 1)) return true;  // the number ends the file
+    }
+    return isSpace(c);
+}
+
+bool ImageDecoder::readGrayRow() {
+    const int width = _info.width;
+
+    if (_pnmType == '1' || _pnmType == '2') {
+        // Plain PNM: one number per pixel. P1 digits need no separator, so they are read one byte at a time.
+        for (int x = 0; x < width; x++) {
+            uint32_t value;
+            if (_pnmType == '2') {
+                if (!readPnmNumber(value)) return false;
+                _gray[x] = min(value, (uint32_t) _maxValue) * 255 / _maxValue;
+                continue;
+            }
+
+            uint8_t c;
+            do {
+                if (!read(&c, 1)) return false;
+                if (c == '#') {
+                    while (c != '\n') {
+                        if (!read(&c, 1)) return false;
+                    }
+                }
+            } while (c != '0' && c != '1');
+            _gray[x] = c == '1' ? 0 : 255;
+        }
+        return true;
+    }
+
+    if (!read(_raw, _rowBytes)) return false;
+
+    switch (_info.format) {
+        case IMAGE_PBM:
+            for (int x = 0; x < width; x++) {
+                _gray[x] = (_raw[x / 8] >> (7 - x % 8)) & 1 ? 0 : 255;
+            }
+            break;
+
+        case IMAGE_PGM:
+            for (int x = 0; x < width; x++) {
+                const uint32_t value = _maxValue > 255 ? (_raw[2 * x] << 8) | _raw[2 * x + 1] : _raw[x];
+                _gray[x] = min(value, (uint32_t) _maxValue) * 255 / _maxValue;
+            }
+            break;
+
+        case IMAGE_BMP:
+            for (int x = 0; x < width; x++) {
+                switch (_bitsPerPixel) {
+                    case 1: _gray[x] = _palette[(_raw[x / 8] >> (7 - x % 8)) & 1]; break;
+                    case 4: _gray[x] = _palette[(_raw[x / 2] >> (x % 2 == 0 ? 4 : 0)) & 0x0F]; break;
+                    case 8: _gray[x] = _palette[_raw[x]]; break;
+                    case 16: {
+                        const uint16_t c = getWord(_raw + 2 * x);
+                        _gray[x] = luma(((c >> 10) & 0x1F) * 255 / 31, ((c >> 5) & 0x1F) * 255 / 31, (c & 0x1F) * 255 / 31);
+                        break;
+                    }
+                    case 24: _gray[x] = luma(_raw[3 * x + 2], _raw[3 * x + 1], _raw[3 * x]); break;
+                    case 32: _gray[x] = luma(_raw[4 * x + 2], _raw[4 * x + 1], _raw[4 * x]); break;
+                }
+            }
+            break;
+
+        default:
+            return false;
+    }
+    return true;
+}
+
+void ImageDecoder::convertRow(int y) {
+    const int width = _info.width;
+    uint8_t *bits = _row->rowData(0);
+    memset(bits, 0, _row->stride);
+
+    if (_dither == DITHER_DIFFUSION) {
+        // Error for this row in _error[1..width], for the next row after it
+        int16_t *current = _error;
+        int16_t *next = _error + width + 2;
+
+        for (int x = 0; x < width; x++) {
+            const int value = _gray[x] + current[x + 1];
+            const bool ink = value < _threshold;
+            const int error = value - (ink ? 0 : 255);
+
+            if (ink) bits[x / 8] |= 0x80 >> (x % 8);
+            current[x + 2] += error * 7 / 16;
+            next[x] += error * 3 / 16;
+            next[x + 1] += error * 5 / 16;
+            next[x + 2] += error / 16;
+        }
+
+        memcpy(current, next, (width + 2) * sizeof(int16_t));
+        memset(next, 0, (width + 2) * sizeof(int16_t));
+        return;
+    }
+
+    for (int x = 0; x < width; x++) {
+        bool ink;
+        if (_dither == DITHER_ORDERED) {
+            const int level = ((255 - _gray[x]) * FillPattern::GRAY_LEVELS + 127) / 255;
+            ink = FillPattern::bayer(x, y) < level;
+        } else {
+            ink = _gray[x] < _threshold;
+        }
+        if (ink) bits[x / 8] |= 0x80 >> (x % 8);
+    }
+}
+
+bool saveRleImage(const BinaryMatrix &image, ByteSink &sink) {
+    const uint8_t header[8] = {
+        RLE_MAGIC[0], RLE_MAGIC[1], RLE_MAGIC[2], RLE_MAGIC[3],
+        (uint8_t) (image.width & 0xFF), (uint8_t) (image.width >> 8),
+        (uint8_t) (image.height & 0xFF), (uint8_t) (image.height >> 8),
+    };
+    if (!sink.write(header, sizeof(header))) return false;
+
+    const int stride = image.stride;
+    uint8_t *delta = (uint8_t*) malloc(stride);
+    uint8_t *encoded = (uint8_t*) malloc(2 * stride + 8);
+    if (delta == nullptr || encoded == nullptr) {
+        Serial.println("Error: not enough memory to encode the image");
+        free(delta);
+        free(encoded);
+        return false;
+    }
+
+    bool ok = true;
+    for (int y = 0; y < image.height && ok; y++) {
+        const uint8_t *row = image.rowData(y);
+        const uint8_t *previous = y > 0 ? image.rowData(y - 1) : nullptr;
+        for (int i = 0; i < stride; i++) {
+            delta[i] = previous != nullptr ? row[i] ^ previous[i] : row[i];
+        }
+
+        const int n = encodeRleRow(delta, stride, encoded);
+        ok = sink.write(encoded, n);
+    }
+
+    free(delta);
+    free(encoded);
+    return ok;
+}
@@ -0,0 +1,92 @@
+#ifndef stream_image_h
+#define stream_image_h
+
+#include <Arduino.h>
+
+#include "binary_matrix.h"
+#include "byte_stream.h"
+
+enum ImageFormat : uint8_t {
+    IMAGE_UNKNOWN,
+    IMAGE_PBM,      // P1 and P4
+    IMAGE_PGM,      // P2 and P5
+    IMAGE_BMP,      // uncompressed, 1, 4, 8, 16 (555), 24 and 32 bits per pixel
+    IMAGE_RLE,      // 1 bit, see saveRleImage()
+};
+
+// How gray pixels become ink (1) or paper (0)
+enum Dither : uint8_t {
+    DITHER_THRESHOLD,   // ink where gray < threshold
+    DITHER_ORDERED,     // 8x8 Bayer matrix, like FillPattern::gray()
+    DITHER_DIFFUSION,   // Floyd-Steinberg
+};
+
+struct ImageInfo {
+    ImageFormat format;
+    uint16_t width;
+    uint16_t height;
+};
+
+/**
+ * Decodes an image from a ByteSource one row at a time, converting each row to 1 bit per pixel
+ * (1 = ink). Only a few rows worth of memory are used whatever the image size, and each row is
+ * read as it is needed, so an image can be drawn while it downloads (e.g. a StreamSource on an
+ * HTTP response).
+ */
+class ImageDecoder {
+    ByteSource &_source;
+    const Dither _dither;
+    const uint8_t _threshold;
+
+    ImageInfo _info = { IMAGE_UNKNOWN, 0, 0 };
+    bool _failed = false;
+    int _rowsRead = 0;
+    uint32_t _position = 0;     // bytes read from the source
+
+    // Format details
+    char _pnmType = 0;          // '1', '2', '4' or '5'
+    uint16_t _maxValue = 1;
+    uint16_t _bitsPerPixel = 0;
+    uint32_t _rowBytes = 0;     // stored bytes per row
+    bool _bottomUp = false;
+    uint8_t _palette[256];      // gray of each BMP palette entry
+
+    uint8_t *_raw = nullptr;    // row as stored
+    uint8_t *_gray = nullptr;   // row as 0 (black) to 255 (white)
+    int16_t *_error = nullptr;  // diffusion error for this row and the next, width + 2 each
+    BinaryMatrix *_row = nullptr;
+
+public:
+    ImageDecoder(ByteSource &source, Dither dither = DITHER_THRESHOLD, uint8_t threshold = 128);
+    ~ImageDecoder();
+
+    // Reads the header and allocates the row buffers; false if the image can't be decoded
+    bool begin();
+    const ImageInfo &info() const;
+
+    // Decodes the next row. Returns nullptr after the last row or on an error, otherwise a
+    // 1 row matrix that is valid until the next call, and sets y to its row in the image (BMP
+    // files are usually stored bottom up).
+    const BinaryMatrix *nextRow(int &y);
+
+    bool failed() const;
+
+private:
+    bool read(uint8_t *data, uint32_t length);
+    bool skip(uint32_t length);
+    bool fail(const char *message);
+
+    bool beginPnm();
+    bool beginBmp();
+    bool beginRle();
+    bool readPnmNumber(uint32_t &value);
+
+    bool readGrayRow();
+    void convertRow(int y);
+};
+
+// Writes image in the IMAGE_RLE format: "ERLI", width and height (16 bit little endian), then
+// each row XORed with the previous one and run-length coded (see row_codec.h)
+bool saveRleImage(const BinaryMatrix &image, ByteSink &sink);
+
+#endif
@@ -0,0 +1,162 @@
+#include "text_cache.h"
+
+TextExtent measureText(const Font &font, const char *text) {
+    TextExtent extent = { INT_MAX, INT_MAX, INT_MIN, INT_MIN, 0, 0, 0 };
+
+    int penX = 0;
+    const int len = strlen(text);
+    for (int i = 0; i < len; i++) {
+        FontChar c = font.getCharacter(text[i]);
+        extent.height = max((int) c.height + c.yoffset, extent.height);
+        extent.width += c.xadvance;
+
+        if (i >= 1) {
+            penX += font.getKerning(text[i-1], text[i]);
+        }
+
+        if (c.width > 0 && c.height > 0) {
+            extent.minX = min(extent.minX, penX + c.xoffset);
+            extent.minY = min(extent.minY, (int) c.yoffset);
+            extent.maxX = max(extent.maxX, penX + c.xoffset + c.width);
+            extent.maxY = max(extent.maxY, c.yoffset + c.height);
+        }
+
+        penX += c.xadvance;
+    }
+
+    extent.advance = penX;
+    if (extent.minX > extent.maxX) {
+        // No visible pixels
+        extent.minX = extent.minY = extent.maxX = extent.maxY = 0;
+    }
+    return extent;
+}
+
+void rasterizeText(const Font &font, const char *text, BinaryMatrix &target, int x, int y, bool value, Rect clip) {
+    clip = clip.intersect(Rect(0, 0, target.width, target.height));
+    int textX = x;
+
+    const int len = strlen(text);
+    for (int i = 0; i < len; i++) {
+        FontChar c = font.getCharacter(text[i]);
+
+        // Apply kerning
+        if (i >= 1) {
+            textX += font.getKerning(text[i-1], text[i]);
+        }
+
+        for (int oy = 0; oy < c.height; oy++) {
+            const int outputY = y + oy + c.yoffset;
+            if (outputY < clip.y || outputY >= clip.y + clip.height) continue;
+
+            for (int ox = 0; ox < c.width; ox++) {
+                const int outputX = textX + ox + c.xoffset;
+                if (outputX < clip.x || outputX >= clip.x + clip.width) continue;
+
+                Pixel p = font.getPixel(c.x + ox, c.y + oy);
+                if (p.b <= 1) {
+                    target.setPixel(outputX, outputY, value);
+                }
+            }
+        }
+
+        textX += c.xadvance;
+    }
+}
+
+
+// FNV-1a over the string, the font and the scale
+static uint32_t hashKey(const Font *font, float scale, const char *text) {
+    uint32_t hash = 2166136261u;
+    for (const char *c = text; *c != 0; c++) {
+        hash = (hash ^ (uint8_t) *c) * 16777619u;
+    }
+    hash = (hash ^ (uint32_t) (uintptr_t) font) * 16777619u;
+    return (hash ^ (uint32_t) (scale * 1024)) * 16777619u;
+}
+
+TextCache::TextCache(uint32_t budgetBytes) : _budget(budgetBytes) {}
+
+TextCache::~TextCache() {
+    clear();
+}
+
+const TextCache::Text *TextCache::get(const Font &font, const char *text) {
+    Key key = { &font, font.getScale(), text, hashKey(&font, font.getScale(), text) };
+
+    auto found = _index.find(key);
+    if (found != _index.end()) {
+        _hits++;
+        _entries.splice(_entries.begin(), _entries, found->second);
+        return &found->second->text;
+    }
+
+    _misses++;
+
+    const TextExtent extent = measureText(font, text);
+    const int width = max(extent.maxX - extent.minX, 1);
+    const int height = max(extent.maxY - extent.minY, 1);
+    const uint32_t bytes = (uint32_t) (width + 7) / 8 * height + sizeof(Entry) + strlen(text);
+    if (bytes > _budget) return nullptr;
+
+    while (_used + bytes > _budget) evict();
+
+    BinaryMatrix *bitmap = new BinaryMatrix(width, height);
+    if (bitmap->buffer == nullptr) {
+        Serial.println("Error: not enough memory to cache text");
+        delete bitmap;
+        return nullptr;
+    }
+    rasterizeText(font, text, *bitmap, -extent.minX, -extent.minY, true, Rect(0, 0, width, height));
+
+    // The string is only copied here; the stored key points to the copy
+    _entries.push_front({ key, text, { bitmap, extent }, bytes });
+    Entry &entry = _entries.front();
+    entry.key.text = entry.string.c_str();
+    _index[entry.key] = _entries.begin();
+    _used += bytes;
+
+    return &_entries.front().text;
+}
+
+void TextCache::clear() {
+    for (Entry &entry : _entries) {
+        delete entry.text.bitmap;
+    }
+    _entries.clear();
+    _index.clear();
+    _used = 0;
+}
+
+uint32_t TextCache::hits() const {
+    return _hits;
+}
+
+uint32_t TextCache::misses() const {
+    return _misses;
+}
+
+uint32_t TextCache::evictions() const {
+    return _evictions;
+}
+
+uint32_t TextCache::bytesUsed() const {
+    return _used;
+}
+
+uint32_t TextCache::budget() const {
+    return _budget;
+}
+
+uint32_t TextCache::size() const {
+    return _entries.size();
+}
+
+void TextCache::evict() {
+    Entry &last = _entries.back();
+    _index.erase(last.key);
+    _used -= last.bytes;
+    delete last.text.bitmap;
+    _entries.pop_back();
+    _evictions++;
+}
@@ -0,0 +1,102 @@
+#ifndef text_cache_h
+#define text_cache_h
+
+#include <Arduino.h>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+#include "binary_matrix.h"
+#include "font.h"
+
+/**
+ * Where the pixels of a text are relative to the pen position it is drawn at (the top left of
+ * the line), and how far the pen moves.
+ */
+struct TextExtent {
+    int minX;
+    int minY;
+    int maxX;       // exclusive
+    int maxY;       // exclusive
+    int advance;    // pen x after the last character, including kerning
+    int width;      // Font::computeWidth, used for alignment
+    int height;     // lowest glyph bottom
+};
+
+TextExtent measureText(const Font &font, const char *text);
+
+// Sets the glyph pixels of text with the pen at (x, y) to value, clipped to clip and target
+void rasterizeText(const Font &font, const char *text, BinaryMatrix &target, int x, int y, bool value, Rect clip);
+
+/**
+ * Rendered 1-bit bitmaps of texts, keyed by font, font scale and string, so labels that are drawn
+ * every frame are blitted instead of being laid out and rasterized glyph by glyph. The cache is
+ * bounded by a memory budget and evicts the least recently used text first.
+ *
+ * Fonts are identified by address: clear() the cache before a font it has seen is destroyed.
+ */
+class TextCache {
+public:
+    struct Text {
+        BinaryMatrix *bitmap;
+        TextExtent extent;   // the bitmap covers [minX, maxX) x [minY, maxY)
+    };
+
+private:
+    // text points to the caller's string while looking up, and to Entry::string once stored, so
+    // a hit allocates nothing
+    struct Key {
+        const Font *font;
+        float scale;
+        const char *text;
+        uint32_t hash;
+
+        bool operator==(const Key &other) const {
+            return hash == other.hash && font == other.font && scale == other.scale && strcmp(text, other.text) == 0;
+        }
+    };
+
+    struct KeyHash {
+        std::size_t operator() (const Key &key) const {
+            return key.hash;
+        }
+    };
+
+    struct Entry {
+        Key key;
+        std::string string;
+        Text text;
+        uint32_t bytes;
+    };
+
+    const uint32_t _budget;
+    uint32_t _used = 0;
+
+    std::list<Entry> _entries; // most recently used first
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> _index;
+
+    uint32_t _hits = 0;
+    uint32_t _misses = 0;
+    uint32_t _evictions = 0;
+
+public:
+    TextCache(uint32_t budgetBytes);
+    ~TextCache();
+
+    // Renders the text on a miss. Returns nullptr if it does not fit in the budget.
+    const Text *get(const Font &font, const char *text);
+
+    void clear();
+
+    uint32_t hits() const;
+    uint32_t misses() const;
+    uint32_t evictions() const;
+    uint32_t bytesUsed() const;
+    uint32_t budget() const;
+    uint32_t size() const;
+
+private:
+    void evict();
+};
+
+#endif
@@ -0,0 +1,56 @@
+#include "tile_pool.h"
+
+TilePool::TilePool(uint16_t tileBytes, uint16_t tilesPerChunk) :
+    _tileBytes(max(tileBytes, (uint16_t) sizeof(uint8_t*))), _tilesPerChunk(tilesPerChunk) { }
+
+TilePool::~TilePool() {
+    for (uint8_t *chunk : _chunks) {
+        free(chunk);
+    }
+}
+
+uint8_t *TilePool::allocate() {
+    if (_free == nullptr) {
+        uint8_t *chunk = (uint8_t*) malloc((uint32_t) _tileBytes * _tilesPerChunk);
+        if (chunk == nullptr) {
+            Serial.println("Error: out of memory for tiles");
+            return nullptr;
+        }
+        _chunks.push_back(chunk);
+
+        for (int i = 0; i < _tilesPerChunk; i++) {
+            uint8_t *tile = chunk + (uint32_t) i * _tileBytes;
+            memcpy(tile, &_free, sizeof(uint8_t*));
+            _free = tile;
+        }
+    }
+
+    uint8_t *tile = _free;
+    memcpy(&_free, tile, sizeof(uint8_t*));
+
+    _inUse++;
+    _peak = max(_peak, _inUse);
+    return tile;
+}
+
+void TilePool::release(uint8_t *tile) {
+    memcpy(tile, &_free, sizeof(uint8_t*));
+    _free = tile;
+    _inUse--;
+}
+
+uint16_t TilePool::tileBytes() const {
+    return _tileBytes;
+}
+
+uint32_t TilePool::tilesInUse() const {
+    return _inUse;
+}
+
+uint32_t TilePool::peakTilesInUse() const {
+    return _peak;
+}
+
+uint32_t TilePool::bytesReserved() const {
+    return (uint32_t) _chunks.size() * _tilesPerChunk * _tileBytes;
+}
@@ -0,0 +1,36 @@
+#ifndef tile_pool_h
+#define tile_pool_h
+
+#include <Arduino.h>
+#include <vector>
+
+/**
+ * Fixed-size blocks for sparse BinaryMatrix tiles. Blocks are carved from chunks allocated on
+ * demand and recycled through a free list, so tiles that come and go between frames do not
+ * fragment the heap. Several matrices with the same tile size may share one pool.
+ */
+class TilePool {
+    const uint16_t _tileBytes;
+    const uint16_t _tilesPerChunk;
+
+    std::vector<uint8_t*> _chunks;
+    uint8_t *_free = nullptr; // free blocks hold the pointer to the next free block
+
+    uint32_t _inUse = 0;
+    uint32_t _peak = 0;
+
+public:
+    TilePool(uint16_t tileBytes, uint16_t tilesPerChunk = 4);
+    ~TilePool();
+
+    // Returns nullptr if no memory is left
+    uint8_t *allocate();
+    void release(uint8_t *tile);
+
+    uint16_t tileBytes() const;
+    uint32_t tilesInUse() const;
+    uint32_t peakTilesInUse() const;
+    uint32_t bytesReserved() const;
+};
+
+#endif
@@ -0,0 +1,465 @@
+#!/usr/bin/env python3
+"""
+Compiles fonts and images into headers for the renderer, so nothing is parsed or converted on
+the device. Uses only the Python standard library.
+
+    asset_compiler.py font  <descriptor.fnt> <name> <output.h> [--runtime]
+    asset_compiler.py image <image.png> <name> <output.h>
+    asset_compiler.py build <assets.txt>
+
+font reads a BMFont descriptor (binary, text or XML) and its PNG pages and writes a CompiledFont:
+the glyphs repacked into one 1-bit sheet, glyph metrics sorted by codepoint and a kerning table
+sorted by pair. With --runtime the header also holds the binary descriptor and an RGB565 sheet
+for the runtime parser (Font(Image, descriptor)), which examples/AssetCheck compares against.
+
+image writes a CompiledBitmap.
+
+build runs every line of a manifest, skipping outputs that are newer than their inputs and the
+compiler. Each line is the arguments of one font or image command, relative to the manifest;
+blank lines and lines starting with # are ignored. Run it before compiling the sketch, e.g. as a
+PlatformIO pre-build script.
+
+Ink is where the pixel, composited over white, has a blue channel below --threshold (default 16,
+which is RGB565 blue <= 1, the test the renderer uses for RGB565 images), or with --ink alpha
+where alpha is at least --threshold (default 128), for sheets exported as white on transparent.
+"""
+
+import argparse
+import os
+import re
+import shlex
+import struct
+import sys
+import zlib
+
+
+# PNG
+
+def read_png(path):
+    """Returns (width, height, rows) where rows holds one list of (r, g, b, a) per row."""
+    with open(path, 'rb') as f:
+        data = f.read()
+
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError('%s: not a PNG file' % path)
+
+    pos = 8
+    idat = b''
+    palette = []
+    transparency = None
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+
+        if kind == b'IHDR':
+            width, height, depth, color, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+        elif kind == b'PLTE':
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif kind == b'tRNS':
+            transparency = chunk
+        elif kind == b'IDAT':
+            idat += chunk
+        elif kind == b'IEND':
+            break
+
+    if interlace:
+        raise ValueError('%s: interlaced PNG is not supported' % path)
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color]
+    bits = channels * depth
+    stride = (width * bits + 7) // 8
+    step = max(1, bits // 8)
+    raw = zlib.decompress(idat)
+
+    rows = []
+    previous = bytearray(stride)
+    for y in range(height):
+        start = y * (stride + 1)
+        kind = raw[start]
+        line = bytearray(raw[start + 1:start + 1 + stride])
+
+        for i in range(stride):
+            left = line[i - step] if i >= step else 0
+            up = previous[i]
+            corner = previous[i - step] if i >= step else 0
+            if kind == 1:
+                line[i] = (line[i] + left) & 0xFF
+            elif kind == 2:
+                line[i] = (line[i] + up) & 0xFF
+            elif kind == 3:
+                line[i] = (line[i] + (left + up) // 2) & 0xFF
+            elif kind == 4:
+                p = left + up - corner
+                pa, pb, pc = abs(p - left), abs(p - up), abs(p - corner)
+                predictor = left if pa <= pb and pa <= pc else (up if pb <= pc else corner)
+                line[i] = (line[i] + predictor) & 0xFF
+        previous = line
+
+        def sample(index):
+            # Channel sample number index of this row, scaled to 8 bits
+            if depth == 8:
+                return line[index]
+            if depth == 16:
+                return line[index * 2]
+            value = (line[index * depth // 8] >> (8 - depth - (index * depth) % 8)) & ((1 << depth) - 1)
+            return value if color == 3 else value * 255 // ((1 << depth) - 1)
+
+        row = []
+        for x in range(width):
+            s = [sample(x * channels + c) for c in range(channels)]
+            if color == 0:
+                row.append((s[0], s[0], s[0], 255))
+            elif color == 2:
+                row.append((s[0], s[1], s[2], 255))
+            elif color == 3:
+                alpha = transparency[s[0]] if transparency and s[0] < len(transparency) else 255
+                row.append(palette[s[0]] + (alpha,))
+            elif color == 4:
+                row.append((s[0], s[0], s[0], s[1]))
+            else:
+                row.append(tuple(s))
+        rows.append(row)
+
+    return width, height, rows
+
+
+def over_white(pixel):
+    r, g, b, a = pixel
+    return tuple((c * a + 255 * (255 - a)) // 255 for c in (r, g, b))
+
+
+def ink_test(args):
+    if args.ink == 'alpha':
+        threshold = 128 if args.threshold is None else args.threshold
+        return lambda pixel: pixel[3] >= threshold
+
+    threshold = 16 if args.threshold is None else args.threshold
+    return lambda pixel: over_white(pixel)[2] < threshold
+
+
+# BMFont descriptor
+
+class Descriptor:
+    def __init__(self):
+        self.info = {}
+        self.common = {}
+        self.pages = {}
+        self.chars = []         # dicts with id, x, y, width, height, xoffset, yoffset, xadvance, page, chnl
+        self.kernings = []      # (first, second, amount)
+
+
+def parse_binary(data):
+    d = Descriptor()
+    pos = 4
+    while pos < len(data):
+        kind, size = struct.unpack('<BI', data[pos:pos + 5])
+        block = data[pos + 5:pos + 5 + size]
+        pos += 5 + size
+
+        if kind == 1:
+            keys = ('size', 'bitField', 'charset', 'stretchH', 'aa', 'paddingUp', 'paddingRight',
+                    'paddingDown', 'paddingLeft', 'spacingHoriz', 'spacingVert', 'outline')
+            d.info = dict(zip(keys, struct.unpack('<hBBHBBBBBBBB', block[:14])))
+            d.info['face'] = block[14:].split(b'\0')[0].decode('latin-1')
+        elif kind == 2:
+            keys = ('lineHeight', 'base', 'scaleW', 'scaleH', 'pages', 'bitField',
+                    'alphaChnl', 'redChnl', 'greenChnl', 'blueChnl')
+            d.common = dict(zip(keys, struct.unpack('<HHHHHBBBBB', block[:15])))
+        elif kind == 3:
+            names = block.split(b'\0')[:-1]
+            d.pages = {i: name.decode('latin-1') for i, name in enumerate(names)}
+        elif kind == 4:
+            keys = ('id', 'x', 'y', 'width', 'height', 'xoffset', 'yoffset', 'xadvance', 'page', 'chnl')
+            for i in range(0, len(block), 20):
+                d.chars.append(dict(zip(keys, struct.unpack('<IHHHHhhhBB', block[i:i + 20]))))
+        elif kind == 5:
+            for i in range(0, len(block), 10):
+                d.kernings.append(struct.unpack('<IIh', block[i:i + 10]))
+    return d
+
+
+def parse_text(text):
+    """Parses the text and the XML variants, which share tag and attribute names."""
+    d = Descriptor()
+    for tag, attributes in re.findall(r'^\s*<?(info|common|page|char|kerning)\s+([^\n>]*)', text, re.M):
+        values = {}
+        for key, quoted, plain in re.findall(r'(\w+)=(?:"([^"]*)"|(\S+))', attributes):
+            value = quoted if quoted or not plain else plain.rstrip('/')
+            values[key] = int(value) if re.match(r'^-?\d+$', value) else value
+
+        if tag == 'info':
+            d.info = values
+        elif tag == 'common':
+            d.common = values
+        elif tag == 'page':
+            d.pages[values['id']] = values['file']
+        elif tag == 'char':
+            values.setdefault('page', 0)
+            values.setdefault('chnl', 15)
+            d.chars.append(values)
+        elif tag == 'kerning':
+            d.kernings.append((values['first'], values['second'], values['amount']))
+    return d
+
+
+def read_descriptor(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:4] == b'BMF\x03':
+        return parse_binary(data)
+    if data[:3] == b'BMF':
+        raise ValueError('%s: only version 3 binary descriptors are supported' % path)
+    return parse_text(data.decode('utf-8'))
+
+
+def encode_binary(d):
+    """Encodes a descriptor in the binary format read by Font(Image, descriptor)."""
+    info = d.info
+    face = str(info.get('face', '')).encode('latin-1') + b'\0'
+    block1 = struct.pack('<hBBHBBBBBBBB', info.get('size', 0), info.get('bitField', 0),
+                         info.get('charset', 0) if isinstance(info.get('charset', 0), int) else 0,
+                         info.get('stretchH', 100), info.get('aa', 1), 0, 0, 0, 0, 0, 0,
+                         info.get('outline', 0)) + face
+
+    common = d.common
+    block2 = struct.pack('<HHHHHBBBBB', common['lineHeight'], common['base'], common['scaleW'],
+                         common['scaleH'], common.get('pages', 1), common.get('bitField', 0),
+                         common.get('alphaChnl', 0), common.get('redChnl', 0),
+                         common.get('greenChnl', 0), common.get('blueChnl', 0))
+
+    block3 = b''.join(d.pages[i].encode('latin-1') + b'\0' for i in sorted(d.pages))
+    block4 = b''.join(struct.pack('<IHHHHhhhBB', c['id'], c['x'], c['y'], c['width'], c['height'],
+                                  c['xoffset'], c['yoffset'], c['xadvance'], c['page'], c['chnl'])
+                      for c in d.chars)
+    block5 = b''.join(struct.pack('<IIh', *k) for k in d.kernings)
+
+    out = b'BMF\x03'
+    for kind, block in enumerate((block1, block2, block3, block4, block5), 1):
+        out += struct.pack('<BI', kind, len(block)) + block
+    return out
+
+
+# Output
+
+def identifier(name):
+    if not re.match(r'^[A-Za-z_]\w*$', name):
+        raise ValueError('%s is not a C identifier' % name)
+    return name
+
+
+def pack_rows(width, height, ink):
+    """Packs ink(x, y) into rows of whole bytes, leftmost pixel in the MSB."""
+    stride = (width + 7) // 8
+    bits = bytearray(stride * height)
+    for y in range(height):
+        for x in range(width):
+            if ink(x, y):
+                bits[y * stride + x // 8] |= 0x80 >> (x % 8)
+    return bits
+
+
+def byte_array(data, indent='    '):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append(indent + ', '.join('0x%02X' % b for b in data[i:i + 16]) + ',')
+    return '\n'.join(lines)
+
+
+def header(name, source, body):
+    guard = '%s_asset_h' % name
+    return ('// Generated by tools/asset_compiler.py from %s. Do not edit.\n\n'
+            '#ifndef %s\n#define %s\n\n#include <compiled_asset.h>\n\n%s\n#endif\n'
+            % (os.path.basename(source), guard, guard, body))
+
+
+def shelf_pack(glyphs, width):
+    """Places glyphs left to right in rows, tallest first. Returns the sheet height."""
+    x = y = row_height = 0
+    for glyph in sorted(glyphs, key=lambda g: (-g['height'], g['id'])):
+        if x + glyph['width'] > width:
+            x, y = 0, y + row_height
+            row_height = 0
+        glyph['packedX'], glyph['packedY'] = x, y
+        x += glyph['width']
+        row_height = max(row_height, glyph['height'])
+    return y + row_height
+
+
+def compile_font(args):
+    name = identifier(args.name)
+    d = read_descriptor(args.source)
+    base = os.path.dirname(args.source)
+    ink = ink_test(args)
+
+    pages = {}
+    for char in d.chars:
+        page = char['page']
+        if page not in pages:
+            pages[page] = read_png(os.path.join(base, d.pages[page]))
+
+    # A later definition of a codepoint or kerning pair replaces the earlier one, as in the runtime parse
+    chars = {}
+    for char in d.chars:
+        chars[char['id']] = dict(char)
+    glyphs = [chars[i] for i in sorted(chars)]
+
+    kernings = {}
+    for first, second, amount in d.kernings:
+        kernings[(first, second)] = amount
+
+    # Repack the glyphs into one sheet, dropping the padding and unused parts of the pages
+    widest = max([g['width'] for g in glyphs] + [1])
+    sheet_width = max(widest, min(args.sheet_width, sum(g['width'] for g in glyphs)))
+    sheet_height = shelf_pack(glyphs, sheet_width)
+
+    sheet = [[False] * sheet_width for _ in range(sheet_height)]
+    for g in glyphs:
+        page_width, page_height, rows = pages[g['page']]
+        for oy in range(g['height']):
+            for ox in range(g['width']):
+                sx, sy = g['x'] + ox, g['y'] + oy
+                if sx < page_width and sy < page_height and ink(rows[sy][sx]):
+                    sheet[g['packedY'] + oy][g['packedX'] + ox] = True
+    bits = pack_rows(sheet_width, sheet_height, lambda x, y: sheet[y][x])
+
+    body = 'static constexpr uint8_t %s_bits[] PROGMEM = {\n%s\n};\n\n' % (name, byte_array(bits))
+    body += 'static constexpr CompiledGlyph %s_glyphs[] PROGMEM = {\n' % name
+    body += '    // id, x, y, width, height, xoffset, yoffset, xadvance\n'
+    for g in glyphs:
+        body += '    { %d, %d, %d, %d, %d, %d, %d, %d },\n' % (
+            g['id'], g['packedX'], g['packedY'], g['width'], g['height'],
+            g['xoffset'], g['yoffset'], g['xadvance'])
+    body += '};\n\n'
+
+    if kernings:
+        body += 'static constexpr CompiledKerning %s_kerning[] PROGMEM = {\n' % name
+        for (first, second) in sorted(kernings):
+            body += '    { %d, %d, %d },\n' % (first, second, kernings[(first, second)])
+        body += '};\n\n'
+
+    body += ('static constexpr CompiledFont %s = {\n'
+             '    %d, %d,\n'
+             '    { %d, %d, %s_bits },\n'
+             '    %s_glyphs, %d,\n'
+             '    %s, %d,\n'
+             '};\n') % (name, d.common['lineHeight'], d.common['base'], sheet_width, sheet_height, name,
+                        name, len(glyphs), name + '_kerning' if kernings else 'nullptr', len(kernings))
+
+    if args.runtime:
+        body += '\n' + runtime_font(name, d, pages)
+
+    write(args.output, header(name, args.source, body))
+    print('%s: %d glyphs, %d kerning pairs, %dx%d sheet, %d bytes'
+          % (args.output, len(glyphs), len(kernings), sheet_width, sheet_height, len(bits)))
+
+
+def runtime_font(name, d, pages):
+    """The same font in the form parsed at runtime, for examples/AssetCheck."""
+    if len(pages) != 1 or 0 not in pages:
+        raise ValueError('--runtime needs a font with a single page')
+
+    width, height, rows = pages[0]
+    pixels = bytearray()
+    for row in rows:
+        for pixel in row:
+            r, g, b = over_white(pixel)
+            pixels += struct.pack('<H', ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3))
+
+    descriptor = encode_binary(d)
+    return ('// Runtime format: Font(Image::asImage(&%s_rgb565), %s_descriptor)\n'
+            'static const unsigned char %s_descriptor[] PROGMEM = {\n%s\n};\n\n'
+            'static const struct {\n'
+            '    unsigned int width;\n'
+            '    unsigned int height;\n'
+            '    unsigned int bytes_per_pixel;\n'
+            '    unsigned char pixel_data[%d];\n'
+            '} %s_rgb565 PROGMEM = {\n'
+            '    %d, %d, 2,\n'
+            '    {\n%s\n    }\n'
+            '};\n') % (name, name, name, byte_array(descriptor), len(pixels), name, width, height,
+                       byte_array(pixels, '        '))
+
+
+def compile_image(args):
+    name = identifier(args.name)
+    width, height, rows = read_png(args.source)
+    ink = ink_test(args)
+    bits = pack_rows(width, height, lambda x, y: ink(rows[y][x]))
+
+    body = 'static constexpr uint8_t %s_bits[] PROGMEM = {\n%s\n};\n\n' % (name, byte_array(bits))
+    body += 'static constexpr CompiledBitmap %s = { %d, %d, %s_bits };\n' % (name, width, height, name)
+
+    write(args.output, header(name, args.source, body))
+    print('%s: %dx%d, %d bytes' % (args.output, width, height, len(bits)))
+
+
+def write(path, text):
+    with open(path, 'w', newline='\n') as f:
+        f.write(text)
+
+
+def build(args):
+    base = os.path.dirname(os.path.abspath(args.manifest))
+    compiler_time = os.path.getmtime(os.path.abspath(__file__))
+
+    with open(args.manifest) as f:
+        lines = [line.strip() for line in f]
+
+    for line in lines:
+        if not line or line.startswith('#'):
+            continue
+
+        entry = parser().parse_args(shlex.split(line))
+        if entry.command == 'build':
+            raise ValueError('build cannot be nested')
+        entry.source = os.path.join(base, entry.source)
+        entry.output = os.path.join(base, entry.output)
+
+        inputs = [entry.source]
+        if entry.command == 'font':
+            d = read_descriptor(entry.source)
+            inputs += [os.path.join(os.path.dirname(entry.source), page) for page in d.pages.values()]
+
+        if os.path.exists(entry.output):
+            newest = max([compiler_time] + [os.path.getmtime(path) for path in inputs])
+            if os.path.getmtime(entry.output) >= newest:
+                continue
+
+        entry.run(entry)
+
+
+def parser():
+    p = argparse.ArgumentParser(description='Compiles fonts and images into headers for the renderer.')
+    commands = p.add_subparsers(dest='command', required=True)
+
+    for command, run, source in (('font', compile_font, 'BMFont descriptor (.fnt)'),
+                                 ('image', compile_image, 'PNG image')):
+        c = commands.add_parser(command)
+        c.add_argument('source', help=source)
+        c.add_argument('name', help='C identifier of the generated asset')
+        c.add_argument('output', help='header to write')
+        c.add_argument('--ink', choices=('dark', 'alpha'), default='dark')
+        c.add_argument('--threshold', type=int)
+        if command == 'font':
+            c.add_argument('--sheet-width', type=int, default=256, help='width of the repacked sheet')
+            c.add_argument('--runtime', action='store_true', help='also emit the runtime format')
+        c.set_defaults(run=run)
+
+    c = commands.add_parser('build')
+    c.add_argument('manifest')
+    c.set_defaults(run=build)
+    return p
+
+
+def main():
+    args = parser().parse_args()
+    try:
+        args.run(args)
+    except (OSError, ValueError, KeyError) as e:
+        print('error: %s' % e, file=sys.stderr)
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
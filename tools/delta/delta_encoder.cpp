@@ -0,0 +1,259 @@
+#include "delta_encoder.h"
+
+#include <string.h>
+#include <algorithm>
+
+// Must match frame_delta.h
+static const uint8_t DELTA_VERSION = 1;
+static const uint8_t DELTA_KEYFRAME = 0x01;
+enum { DELTA_FILL, DELTA_REPLACE, DELTA_XOR };
+
+// Changed bytes closer than this on a row, and changed rows closer than this, share a rect
+static const int MERGE_BYTES = 4;
+static const int MERGE_ROWS = 2;
+
+// Shorter repeats are cheaper as part of a literal
+static const int MIN_RUN = 3;
+
+static void putWord(std::vector<uint8_t> &out, uint16_t value) {
+    out.push_back(value & 0xFF);
+    out.push_back(value >> 8);
+}
+
+static void putVarint(std::vector<uint8_t> &out, uint32_t value) {
+    while (value >= 0x80) {
+        out.push_back((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    out.push_back(value);
+}
+
+static void putLiteral(std::vector<uint8_t> &out, const uint8_t *data, int length) {
+    putVarint(out, length << 1);
+    out.insert(out.end(), data, data + length);
+}
+
+// Same token format as row_codec.h
+static void encodeRleRow(std::vector<uint8_t> &out, const uint8_t *row, int length) {
+    int literalStart = 0;
+    int i = 0;
+
+    while (i < length) {
+        int run = 1;
+        while (i + run < length && row[i + run] == row[i]) run++;
+
+        if (run < MIN_RUN) {
+            i += run;
+            continue;
+        }
+
+        if (literalStart < i) putLiteral(out, row + literalStart, i - literalStart);
+        putVarint(out, (run << 1) | 1);
+        out.push_back(row[i]);
+
+        i += run;
+        literalStart = i;
+    }
+
+    if (literalStart < length) putLiteral(out, row + literalStart, length - literalStart);
+}
+
+
+DeltaFrame::DeltaFrame(int width, int height) :
+    width(width), height(height), stride((width + 7) / 8),
+    black(stride * height, 0), red(stride * height, 0) {}
+
+void DeltaFrame::setPixel(int x, int y, bool red, bool value) {
+    if (x < 0 || x >= width || y < 0 || y >= height) return;
+
+    uint8_t &byte = (red ? this->red : black)[y * stride + x / 8];
+    if (value) {
+        byte |= 0x80 >> (x % 8);
+    } else {
+        byte &= ~(0x80 >> (x % 8));
+    }
+}
+
+bool DeltaFrame::getPixel(int x, int y, bool red) const {
+    if (x < 0 || x >= width || y < 0 || y >= height) return false;
+
+    return ((red ? this->red : black)[y * stride + x / 8] >> (7 - x % 8)) & 1;
+}
+
+
+DeltaEncoder::DeltaEncoder(int width, int height) : _device(width, height) {
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+std::vector<uint8_t> DeltaEncoder::encode(const DeltaFrame &frame) {
+    std::vector<uint8_t> records;
+    const bool keyframe = !_synced;
+
+    memset(&_stats, 0, sizeof(_stats));
+    _stats.frameBytes = 2 * _device.black.size();
+
+    if (frame.width != _device.width || frame.height != _device.height) return records;
+
+    for (int plane = 0; plane < 2; plane++) {
+        std::vector<uint8_t> &current = plane == 0 ? _device.black : _device.red;
+        const std::vector<uint8_t> &next = plane == 0 ? frame.black : frame.red;
+
+        if (keyframe) {
+            encodeRect(records, plane, ByteRect { 0, _device.stride, 0, _device.height }, current, next, true);
+            continue;
+        }
+
+        for (const ByteRect &rect : findChanges(current, next)) {
+            encodeRect(records, plane, rect, current, next, false);
+        }
+    }
+
+    std::vector<uint8_t> out = { 'E', 'D', 'L', 'T', DELTA_VERSION, (uint8_t) (keyframe ? DELTA_KEYFRAME : 0) };
+    putWord(out, _device.width);
+    putWord(out, _device.height);
+    putWord(out, _sequence);
+    putWord(out, _sequence + 1);
+    putWord(out, _stats.rects);
+    putWord(out, records.size() & 0xFFFF);
+    putWord(out, records.size() >> 16);
+    out.insert(out.end(), records.begin(), records.end());
+
+    _sequence++;
+    _synced = true;
+    _stats.bytes = out.size();
+    return out;
+}
+
+void DeltaEncoder::reset() {
+    _synced = false;
+}
+
+const DeltaEncodeStats &DeltaEncoder::stats() const {
+    return _stats;
+}
+
+std::vector<DeltaEncoder::ByteRect> DeltaEncoder::findChanges(const std::vector<uint8_t> &current,
+        const std::vector<uint8_t> &next) const {
+    const int stride = _device.stride;
+    std::vector<ByteRect> open;
+    std::vector<ByteRect> closed;
+
+    for (int y = 0; y < _device.height; y++) {
+        const uint8_t *a = &current[y * stride];
+        const uint8_t *b = &next[y * stride];
+
+        // Changed spans of this row, merged across short gaps
+        int x = 0;
+        while (x < stride) {
+            if (a[x] == b[x]) {
+                x++;
+                continue;
+            }
+
+            int end = x + 1;
+            for (int gap = 0; end + gap < stride && gap < MERGE_BYTES; ) {
+                if (a[end + gap] != b[end + gap]) {
+                    end += gap + 1;
+                    gap = 0;
+                } else {
+                    gap++;
+                }
+            }
+
+            // Grow the open rects this span touches into one
+            ByteRect span = { x, end, y, y + 1 };
+            for (size_t i = 0; i < open.size(); ) {
+                if (open[i].x0 < span.x1 + MERGE_BYTES && span.x0 < open[i].x1 + MERGE_BYTES) {
+                    span.x0 = std::min(span.x0, open[i].x0);
+                    span.x1 = std::max(span.x1, open[i].x1);
+                    span.y0 = std::min(span.y0, open[i].y0);
+                    open.erase(open.begin() + i);
+                } else {
+                    i++;
+                }
+            }
+            open.push_back(span);
+
+            x = end;
+        }
+
+        // Rects without changes in the last rows are done
+        for (size_t i = 0; i < open.size(); ) {
+            if (y - open[i].y1 >= MERGE_ROWS) {
+                closed.push_back(open[i]);
+                open.erase(open.begin() + i);
+            } else {
+                i++;
+            }
+        }
+    }
+
+    closed.insert(closed.end(), open.begin(), open.end());
+    return closed;
+}
+
+void DeltaEncoder::encodeRect(std::vector<uint8_t> &out, int plane, const ByteRect &rect,
+        std::vector<uint8_t> &current, const std::vector<uint8_t> &next, bool keyframe) {
+    const int stride = _device.stride;
+    const int x = rect.x0 * 8;
+    const int width = std::min(rect.x1 * 8, _device.width) - x;
+    const int rowBytes = rect.x1 - rect.x0;
+
+    // Bits of the last byte inside the plane
+    const uint8_t lastMask = (x + width) % 8 == 0 ? 0xFF : (uint8_t) (0xFF << (8 - (x + width) % 8));
+
+    bool allClear = true;
+    bool allSet = true;
+    for (int y = rect.y0; y < rect.y1; y++) {
+        for (int i = rect.x0; i < rect.x1; i++) {
+            const uint8_t mask = i == rect.x1 - 1 ? lastMask : 0xFF;
+            const uint8_t value = next[y * stride + i] & mask;
+            allClear = allClear && value == 0;
+            allSet = allSet && value == mask;
+        }
+    }
+
+    std::vector<uint8_t> replace;
+    std::vector<uint8_t> xorred;
+    std::vector<uint8_t> delta(rowBytes);
+    if (!allClear && !allSet) {
+        for (int y = rect.y0; y < rect.y1; y++) {
+            encodeRleRow(replace, &next[y * stride + rect.x0], rowBytes);
+            if (keyframe) continue;
+
+            for (int i = 0; i < rowBytes; i++) {
+                delta[i] = current[y * stride + rect.x0 + i] ^ next[y * stride + rect.x0 + i];
+            }
+            encodeRleRow(xorred, delta.data(), rowBytes);
+        }
+    }
+
+    uint8_t mode = DELTA_REPLACE;
+    if (allClear || allSet) {
+        mode = DELTA_FILL;
+    } else if (!keyframe && xorred.size() < replace.size()) {
+        mode = DELTA_XOR;
+    }
+
+    out.push_back(plane);
+    out.push_back(mode);
+    putWord(out, x);
+    putWord(out, rect.y0);
+    putWord(out, width);
+    putWord(out, rect.y1 - rect.y0);
+
+    if (mode == DELTA_FILL) {
+        out.push_back(allSet ? 0xFF : 0x00);
+    } else {
+        const std::vector<uint8_t> &data = mode == DELTA_XOR ? xorred : replace;
+        out.insert(out.end(), data.begin(), data.end());
+    }
+
+    // The device now shows the new pixels of the rect
+    for (int y = rect.y0; y < rect.y1; y++) {
+        memcpy(&current[y * stride + rect.x0], &next[y * stride + rect.x0], rowBytes);
+    }
+
+    _stats.rects++;
+    _stats.pixels += (long) width * (rect.y1 - rect.y0);
+}
@@ -0,0 +1,69 @@
+#ifndef delta_encoder_h
+#define delta_encoder_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+/**
+ * Host side encoder of the frame delta format read by DeltaDecoder (frame_delta.h). Plain C++11
+ * without Arduino headers, so a server or a test process can compose frames and send the
+ * changes to devices.
+ *
+ * The encoder keeps a copy of what the device shows. Each frame is compared with it plane by
+ * plane; changed rows are grouped into byte aligned rects, and each rect is sent as a fill, the
+ * new pixels or the XOR with the old pixels, whichever is smallest.
+ */
+
+// Black and red planes in the BinaryMatrix layout: rows of (width + 7) / 8 bytes, leftmost pixel
+// in the MSB, 1 = ink
+struct DeltaFrame {
+    int width;
+    int height;
+    int stride;
+    std::vector<uint8_t> black;
+    std::vector<uint8_t> red;
+
+    DeltaFrame(int width, int height);
+
+    void setPixel(int x, int y, bool red, bool value);
+    bool getPixel(int x, int y, bool red) const;
+};
+
+struct DeltaEncodeStats {
+    size_t bytes;       // size of the delta, including the header
+    int rects;
+    long pixels;        // area of the rects
+    size_t frameBytes;  // size of both planes uncompressed, for comparison
+};
+
+class DeltaEncoder {
+    DeltaFrame _device;
+    bool _synced = false;
+    uint16_t _sequence = 0;
+    DeltaEncodeStats _stats;
+
+public:
+    DeltaEncoder(int width, int height);
+
+    // Encodes the changes from the frame the device shows to frame. The first delta, and the
+    // first one after reset(), is a keyframe that applies to any device state.
+    std::vector<uint8_t> encode(const DeltaFrame &frame);
+
+    // The device state is unknown, e.g. after a reconnect
+    void reset();
+
+    const DeltaEncodeStats &stats() const;
+
+private:
+    struct ByteRect {
+        int x0, x1;     // bytes [x0, x1)
+        int y0, y1;     // rows [y0, y1)
+    };
+
+    std::vector<ByteRect> findChanges(const std::vector<uint8_t> &current, const std::vector<uint8_t> &next) const;
+    void encodeRect(std::vector<uint8_t> &out, int plane, const ByteRect &rect, std::vector<uint8_t> &current,
+        const std::vector<uint8_t> &next, bool keyframe);
+};
+
+#endif
@@ -0,0 +1,176 @@
+// Stand-in for the server that composes screens: encodes a sequence of frames as deltas and
+// either serves them over TCP or writes them to a file, printing the size of every update.
+//
+//   g++ -std=c++11 -O2 -o delta_server delta_server.cpp delta_encoder.cpp
+//   ./delta_server [--port 5000] [--interval 5000] [--loop] frame.pbm[,red.pbm] ...
+//   ./delta_server --file deltas.bin frame.pbm[,red.pbm] ...
+//
+// Frames are binary PBM (P4) files of the panel size, the black plane optionally followed by the
+// red one. A client gets a keyframe when it connects, then one delta per interval.
+
+#include "delta_encoder.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+static bool readToken(FILE *file, int &value) {
+    int c = fgetc(file);
+    while (c == '#' || c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+        if (c == '#') {
+            while (c != '\n' && c != EOF) c = fgetc(file);
+        }
+        c = fgetc(file);
+    }
+
+    value = 0;
+    if (c < '0' || c > '9') return false;
+    while (c >= '0' && c <= '9') {
+        value = value * 10 + (c - '0');
+        c = fgetc(file);
+    }
+    return true;
+}
+
+static bool readPbm(const std::string &path, DeltaFrame *frame, std::vector<uint8_t> &plane) {
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        fprintf(stderr, "error: can't open %s\n", path.c_str());
+        return false;
+    }
+
+    int width, height;
+    const bool ok = fgetc(file) == 'P' && fgetc(file) == '4' && readToken(file, width) && readToken(file, height)
+        && width == frame->width && height == frame->height
+        && fread(plane.data(), 1, plane.size(), file) == plane.size();
+    fclose(file);
+
+    if (!ok) fprintf(stderr, "error: %s is not a %dx%d P4 PBM file\n", path.c_str(), frame->width, frame->height);
+    return ok;
+}
+
+static bool pbmSize(const std::string &path, int &width, int &height) {
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file == nullptr) return false;
+
+    const bool ok = fgetc(file) == 'P' && fgetc(file) == '4' && readToken(file, width) && readToken(file, height);
+    fclose(file);
+    return ok;
+}
+
+static bool loadFrame(const std::string &spec, DeltaFrame &frame) {
+    const size_t comma = spec.find(',');
+    if (!readPbm(spec.substr(0, comma), &frame, frame.black)) return false;
+    if (comma != std::string::npos && !readPbm(spec.substr(comma + 1), &frame, frame.red)) return false;
+    return true;
+}
+
+static void report(int index, const DeltaEncoder &encoder) {
+    const DeltaEncodeStats &stats = encoder.stats();
+    printf("frame %d: %zu bytes (%.1f%% of %zu), %d rects, %ld pixels\n", index, stats.bytes,
+        100.0 * stats.bytes / stats.frameBytes, stats.frameBytes, stats.rects, stats.pixels);
+}
+
+static bool sendAll(int socket, const std::vector<uint8_t> &data) {
+    size_t sent = 0;
+    while (sent < data.size()) {
+        const ssize_t n = send(socket, data.data() + sent, data.size() - sent, 0);
+        if (n <= 0) return false;
+        sent += n;
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    int port = 5000;
+    int intervalMs = 5000;
+    bool loop = false;
+    const char *outputPath = nullptr;
+    std::vector<std::string> specs;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if (arg == "--port" && i + 1 < argc) {
+            port = atoi(argv[++i]);
+        } else if (arg == "--interval" && i + 1 < argc) {
+            intervalMs = atoi(argv[++i]);
+        } else if (arg == "--file" && i + 1 < argc) {
+            outputPath = argv[++i];
+        } else if (arg == "--loop") {
+            loop = true;
+        } else {
+            specs.push_back(arg);
+        }
+    }
+
+    int width, height;
+    if (specs.empty() || !pbmSize(specs[0].substr(0, specs[0].find(',')), width, height)) {
+        fprintf(stderr, "usage: %s [--port N] [--interval ms] [--loop] [--file out] frame.pbm[,red.pbm] ...\n", argv[0]);
+        return 1;
+    }
+
+    std::vector<DeltaFrame> frames;
+    for (const std::string &spec : specs) {
+        frames.push_back(DeltaFrame(width, height));
+        if (!loadFrame(spec, frames.back())) return 1;
+    }
+
+    if (outputPath != nullptr) {
+        FILE *out = fopen(outputPath, "wb");
+        if (out == nullptr) {
+            fprintf(stderr, "error: can't write %s\n", outputPath);
+            return 1;
+        }
+
+        DeltaEncoder encoder(width, height);
+        for (size_t i = 0; i < frames.size(); i++) {
+            const std::vector<uint8_t> delta = encoder.encode(frames[i]);
+            fwrite(delta.data(), 1, delta.size(), out);
+            report(i, encoder);
+        }
+        fclose(out);
+        return 0;
+    }
+
+    signal(SIGPIPE, SIG_IGN);
+    const int listener = socket(AF_INET, SOCK_STREAM, 0);
+    const int yes = 1;
+    setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+
+    sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(port);
+    if (bind(listener, (sockaddr*) &address, sizeof(address)) != 0 || listen(listener, 1) != 0) {
+        perror("error: can't listen");
+        return 1;
+    }
+    printf("serving %zu frames of %dx%d on port %d\n", frames.size(), width, height, port);
+
+    while (true) {
+        const int client = accept(listener, nullptr, nullptr);
+        if (client < 0) continue;
+        printf("client connected\n");
+
+        // A new client gets a keyframe first
+        DeltaEncoder encoder(width, height);
+        for (size_t i = 0; loop || i < frames.size(); i++) {
+            const std::vector<uint8_t> delta = encoder.encode(frames[i % frames.size()]);
+            if (!sendAll(client, delta)) break;
+            report(i % frames.size(), encoder);
+            usleep(intervalMs * 1000);
+        }
+
+        close(client);
+        printf("client disconnected\n");
+    }
+}
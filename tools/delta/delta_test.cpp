@@ -0,0 +1,180 @@
+// DeltaEncoder against DeltaDecoder (frame_delta.h): a sequence of frames arrives intact, replayed
+// and stale deltas are rejected, and a truncated delta leaves the decoder unsynced until the next
+// keyframe. Built against the library and the Arduino shim:
+//
+//   make -C ../host test
+
+#include "delta_encoder.h"
+#include "frame_delta.h"
+
+#include "host_test.h"
+
+static const int WIDTH = 880;
+static const int HEIGHT = 528;
+
+static bool samePixels(const DeltaFrame &frame, const BinaryMatrix &black, const BinaryMatrix &red) {
+    for (int y = 0; y < HEIGHT; y++) {
+        if (memcmp(&frame.black[y * frame.stride], black.rowData(y), frame.stride) != 0) return false;
+        if (memcmp(&frame.red[y * frame.stride], red.rowData(y), frame.stride) != 0) return false;
+    }
+    return true;
+}
+
+static bool covered(const DirtyRegion &region, int x, int y) {
+    for (int i = 0; i < region.count(); i++) {
+        const Rect &r = region[i];
+        if (x >= r.x && x < r.x + r.width && y >= r.y && y < r.y + r.height) return true;
+    }
+    return false;
+}
+
+// Changes like those of a dashboard: a few rects, values redrawn as noise, and a red marker
+static void edit(DeltaFrame &frame, int step) {
+    const int rects = rand() % 4;
+    for (int i = 0; i < rects; i++) {
+        const int x = rand() % (WIDTH - 120);
+        const int y = rand() % (HEIGHT - 60);
+        const int w = 1 + rand() % 120;
+        const int h = 1 + rand() % 60;
+        const bool value = rand() % 2;
+        for (int yy = y; yy < y + h; yy++) {
+            for (int xx = x; xx < x + w; xx++) frame.setPixel(xx, yy, false, value);
+        }
+    }
+
+    const int fieldY = 100 + (step % 5) * 60;
+    for (int y = fieldY; y < fieldY + 24; y++) {
+        for (int x = 600; x < 780; x++) frame.setPixel(x, y, false, rand() % 4 == 0);
+    }
+
+    const int markerX = (step * 37) % (WIDTH - 16);
+    for (int y = 500; y < 516; y++) {
+        for (int x = 0; x < WIDTH; x++) frame.setPixel(x, y, true, x >= markerX && x < markerX + 16);
+    }
+}
+
+static bool apply(DeltaDecoder &decoder, BinaryMatrix &black, BinaryMatrix &red, const std::vector<uint8_t> &delta,
+        DirtyRegion *touched = nullptr) {
+    MemorySource source(delta.data(), delta.size());
+    return decoder.apply(black, red, source, touched);
+}
+
+static void testSequence() {
+    DeltaEncoder encoder(WIDTH, HEIGHT);
+    DeltaDecoder decoder;
+    DeltaFrame frame(WIDTH, HEIGHT);
+    BinaryMatrix black(WIDTH, HEIGHT);
+    BinaryMatrix red(WIDTH, HEIGHT);
+
+    srand(43);
+    size_t deltaBytes = 0;
+    for (int step = 0; step < 40; step++) {
+        DeltaFrame previous = frame;
+        edit(frame, step);
+        const std::vector<uint8_t> delta = encoder.encode(frame);
+        if (step > 0) deltaBytes += delta.size();
+
+        DirtyRegion touched;
+        CHECK(apply(decoder, black, red, delta, &touched));
+        CHECK(decoder.isSynced());
+        CHECK(samePixels(frame, black, red));
+
+        // Every changed pixel is in a rect the decoder reported
+        bool allCovered = true;
+        for (int y = 0; y < HEIGHT; y++) {
+            for (int x = 0; x < WIDTH; x++) {
+                const bool changed = frame.getPixel(x, y, false) != previous.getPixel(x, y, false)
+                    || frame.getPixel(x, y, true) != previous.getPixel(x, y, true);
+                if (changed && !covered(touched, x, y)) allCovered = false;
+            }
+        }
+        CHECK(allCovered);
+    }
+
+    // Deltas are much smaller than the frames
+    CHECK(deltaBytes < 39 * encoder.stats().frameBytes / 10);
+}
+
+static void testReplay() {
+    DeltaEncoder encoder(WIDTH, HEIGHT);
+    DeltaDecoder decoder;
+    DeltaFrame frame(WIDTH, HEIGHT);
+    BinaryMatrix black(WIDTH, HEIGHT);
+    BinaryMatrix red(WIDTH, HEIGHT);
+
+    srand(44);
+    edit(frame, 0);
+    CHECK(apply(decoder, black, red, encoder.encode(frame)));
+
+    edit(frame, 1);
+    const std::vector<uint8_t> first = encoder.encode(frame);
+    DeltaFrame afterFirst = frame;
+    edit(frame, 2);
+    const std::vector<uint8_t> second = encoder.encode(frame);
+
+    // A delta applies once; a replay or an older one is rejected and changes nothing
+    CHECK(apply(decoder, black, red, first));
+    CHECK(!apply(decoder, black, red, first));
+    CHECK(decoder.isSynced());
+    CHECK(samePixels(afterFirst, black, red));
+
+    // A rejected delta is skipped whole, so the next one in the stream is read from its header
+    std::vector<uint8_t> stream = first;
+    stream.insert(stream.end(), second.begin(), second.end());
+    MemorySource source(stream.data(), stream.size());
+    CHECK(!decoder.apply(black, red, source));
+    CHECK(decoder.apply(black, red, source));
+    CHECK(samePixels(frame, black, red));
+    CHECK(!apply(decoder, black, red, first));
+}
+
+static void testTruncated() {
+    DeltaEncoder encoder(WIDTH, HEIGHT);
+    DeltaDecoder decoder;
+    DeltaFrame frame(WIDTH, HEIGHT);
+    BinaryMatrix black(WIDTH, HEIGHT);
+    BinaryMatrix red(WIDTH, HEIGHT);
+
+    srand(45);
+    edit(frame, 0);
+    CHECK(apply(decoder, black, red, encoder.encode(frame)));
+
+    for (int cut = 0; cut < 5; cut++) {
+        edit(frame, cut + 1);
+        std::vector<uint8_t> delta = encoder.encode(frame);
+        CHECK(delta.size() > DELTA_HEADER_BYTES + DELTA_RECORD_BYTES);
+        const uint16_t sequence = decoder.sequence();
+
+        // Cut inside the records: the decoder no longer knows what the panel shows
+        delta.resize(DELTA_HEADER_BYTES + rand() % (delta.size() - DELTA_HEADER_BYTES));
+        CHECK(!apply(decoder, black, red, delta));
+        CHECK(!decoder.isSynced());
+        CHECK(decoder.sequence() == sequence);
+
+        // Later deltas don't apply on top of a partial frame
+        edit(frame, cut + 10);
+        CHECK(!apply(decoder, black, red, encoder.encode(frame)));
+        CHECK(!decoder.isSynced());
+
+        // The server notices and sends a keyframe, which applies to whatever is shown
+        encoder.reset();
+        const std::vector<uint8_t> keyframe = encoder.encode(frame);
+        CHECK(keyframe[5] & DELTA_KEYFRAME);
+        CHECK(apply(decoder, black, red, keyframe));
+        CHECK(decoder.isSynced());
+        CHECK(samePixels(frame, black, red));
+    }
+
+    // A stream cut inside the header
+    edit(frame, 20);
+    std::vector<uint8_t> delta = encoder.encode(frame);
+    delta.resize(DELTA_HEADER_BYTES - 1);
+    CHECK(!apply(decoder, black, red, delta));
+}
+
+int main() {
+    testSequence();
+    testReplay();
+    testTruncated();
+    return testResult();
+}
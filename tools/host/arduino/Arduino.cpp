@@ -0,0 +1,165 @@
+#include <Arduino.h>
+#include <SPI.h>
+
+#include <chrono>
+#include <random>
+
+HardwareSerial Serial;
+SPIClass SPI;
+
+static const std::chrono::steady_clock::time_point clockStart = std::chrono::steady_clock::now();
+static uint64_t delayedMicros = 0;
+
+static uint64_t elapsedMicros() {
+    const std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - clockStart;
+    return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() + delayedMicros;
+}
+
+unsigned long millis() {
+    return (uint32_t) (elapsedMicros() / 1000);
+}
+
+unsigned long micros() {
+    return (uint32_t) elapsedMicros();
+}
+
+void delay(unsigned long ms) {
+    delayedMicros += (uint64_t) ms * 1000;
+}
+
+void delayMicroseconds(unsigned int us) {
+    delayedMicros += us;
+}
+
+void yield() {}
+
+void pinMode(int, int) {}
+
+void digitalWrite(int, int) {}
+
+// BUSY reads low, so a panel on the hardware transports is never busy
+int digitalRead(int) {
+    return LOW;
+}
+
+static volatile uint32_t portRegister;
+
+volatile uint32_t *portOutputRegister(int) {
+    return &portRegister;
+}
+
+static std::mt19937 generator(1);
+
+void randomSeed(unsigned long seed) {
+    generator.seed(seed);
+}
+
+long random(long max) {
+    return random(0, max);
+}
+
+long random(long min, long max) {
+    if (max <= min) return min;
+    return min + (long) (generator() % (uint32_t) (max - min));
+}
+
+
+// Print
+
+size_t Print::write(const uint8_t *data, size_t length) {
+    size_t written = 0;
+    while (written < length && write(data[written]) == 1) written++;
+    return written;
+}
+
+size_t Print::print(const char *text) {
+    return write((const uint8_t*) text, strlen(text));
+}
+
+size_t Print::print(const String &text) {
+    return write((const uint8_t*) text.data(), text.size());
+}
+
+size_t Print::print(char value) {
+    return write((uint8_t) value);
+}
+
+size_t Print::print(int value) {
+    return printf("%d", value);
+}
+
+size_t Print::print(unsigned int value) {
+    return printf("%u", value);
+}
+
+size_t Print::print(long value) {
+    return printf("%ld", value);
+}
+
+size_t Print::print(unsigned long value) {
+    return printf("%lu", value);
+}
+
+size_t Print::print(double value, int digits) {
+    return printf("%.*f", digits, value);
+}
+
+size_t Print::println() {
+    return print("\n");
+}
+
+int Print::printf(const char *format, ...) {
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (length < 0) return length;
+
+    if ((size_t) length >= sizeof(buffer)) {
+        std::string text(length, '\0');
+        va_start(args, format);
+        vsnprintf(&text[0], length + 1, format, args);
+        va_end(args);
+        return write((const uint8_t*) text.data(), length);
+    }
+    return write((const uint8_t*) buffer, length);
+}
+
+
+// Stream
+
+size_t Stream::readBytes(uint8_t *data, size_t length) {
+    size_t count = 0;
+    while (count < length) {
+        const int value = read();
+        if (value < 0) break;
+        data[count++] = value;
+    }
+    return count;
+}
+
+
+// HardwareSerial
+
+void HardwareSerial::begin(unsigned long) {}
+
+int HardwareSerial::available() {
+    return 0;
+}
+
+int HardwareSerial::read() {
+    return -1;
+}
+
+int HardwareSerial::peek() {
+    return -1;
+}
+
+size_t HardwareSerial::write(uint8_t value) {
+    return fwrite(&value, 1, 1, stdout);
+}
+
+size_t HardwareSerial::write(const uint8_t *data, size_t length) {
+    return fwrite(data, 1, length, stdout);
+}
@@ -0,0 +1,125 @@
+#ifndef host_arduino_h
+#define host_arduino_h
+
+/**
+ * The part of the Arduino API the library uses, for building it on the host. Serial prints to
+ * stdout and the pins do nothing. delay() advances millis() and micros() instead of sleeping,
+ * so code that waits on time runs at full speed while still seeing the time pass.
+ */
+
+#include <limits.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <string>
+
+using std::min;
+using std::max;
+
+typedef uint8_t byte;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define LSBFIRST 0
+#define MSBFIRST 1
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+#define IRAM_ATTR
+#define constrain(value, low, high) ((value) < (low) ? (low) : ((value) > (high) ? (high) : (value)))
+
+class String : public std::string {
+public:
+    String(const char *text = "") : std::string(text) {}
+    String(const std::string &text) : std::string(text) {}
+    explicit String(int value) : std::string(std::to_string(value)) {}
+    explicit String(unsigned int value) : std::string(std::to_string(value)) {}
+    explicit String(long value) : std::string(std::to_string(value)) {}
+    explicit String(unsigned long value) : std::string(std::to_string(value)) {}
+};
+
+inline String operator+(const char *a, const String &b) {
+    return String(a + static_cast<const std::string&>(b));
+}
+
+inline String operator+(const String &a, const char *b) {
+    return String(static_cast<const std::string&>(a) + b);
+}
+
+class Print {
+public:
+    virtual ~Print() {}
+
+    virtual size_t write(uint8_t value) = 0;
+    virtual size_t write(const uint8_t *data, size_t length);
+
+    size_t print(const char *text);
+    size_t print(const String &text);
+    size_t print(char value);
+    size_t print(int value);
+    size_t print(unsigned int value);
+    size_t print(long value);
+    size_t print(unsigned long value);
+    size_t print(double value, int digits = 2);
+
+    size_t println();
+    template<class T> size_t println(const T &value) { return print(value) + println(); }
+
+    int printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    size_t readBytes(uint8_t *data, size_t length);
+    using Print::write;
+};
+
+class HardwareSerial : public Stream {
+public:
+    void begin(unsigned long baud);
+
+    int available() override;
+    int read() override;
+    int peek() override;
+    size_t write(uint8_t value) override;
+    size_t write(const uint8_t *data, size_t length) override;
+};
+
+extern HardwareSerial Serial;
+
+void pinMode(int pin, int mode);
+void digitalWrite(int pin, int value);
+int digitalRead(int pin);
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+void randomSeed(unsigned long seed);
+long random(long max);
+long random(long min, long max);
+
+// Generic core: one 32 bit output register per pin
+#define digitalPinToPort(pin) (pin)
+#define digitalPinToBitMask(pin) (1UL)
+volatile uint32_t *portOutputRegister(int port);
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef host_spi_h
+#define host_spi_h
+
+#include <Arduino.h>
+
+#define SPI_MODE0 0
+
+class SPISettings {
+public:
+    SPISettings() {}
+    SPISettings(uint32_t, uint8_t, uint8_t) {}
+};
+
+// Discards everything sent
+class SPIClass {
+public:
+    void begin() {}
+    void end() {}
+    void beginTransaction(SPISettings) {}
+    void endTransaction() {}
+
+    uint8_t transfer(uint8_t) { return 0; }
+    void writeBytes(const uint8_t *, uint32_t) {}
+    void writePattern(const uint8_t *, uint8_t, uint32_t) {}
+};
+
+extern SPIClass SPI;
+
+#endif
@@ -0,0 +1,17 @@
+#ifndef host_pgmspace_h
+#define host_pgmspace_h
+
+#include <stdint.h>
+#include <string.h>
+
+// Program memory is ordinary memory on the host
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#define pgm_read_byte(address) (*(const uint8_t*) (address))
+#define pgm_read_word(address) (*(const uint16_t*) (address))
+#define pgm_read_dword(address) (*(const uint32_t*) (address))
+#define memcpy_P memcpy
+
+#endif
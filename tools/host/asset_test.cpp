@@ -0,0 +1,124 @@
+// Assets compiled by tools/asset_compiler.py draw exactly like the runtime parse of the same
+// source. The Makefile compiles the examples/AssetCheck fixture into build/assets, so this runs
+// the compiler as it is, on a font with partial alpha and overridden kerning and on its sheet
+// as an image.
+
+#include "renderer.h"
+
+#include <vector>
+
+#include "check_font.h"
+#include "check_sheet.h"
+#include "host_test.h"
+
+static const int WIDTH = 880;
+static const int HEIGHT = 528;
+
+static const char *SAMPLES[] = {
+    "ABCDEFGHIJKLMNO",
+    "AAHBOCD AA.,EF",
+    " !\"#$%&'()*+,-./",
+    "0123456789:;<=>?@",
+};
+
+static std::vector<uint8_t> planes(const Renderer &renderer) {
+    std::vector<uint8_t> buffer(2 * WIDTH / 8 * HEIGHT + 1024);
+    MemorySink sink(buffer.data(), buffer.size());
+    CHECK(renderer.saveSnapshot(sink));
+    buffer.resize(sink.size());
+    return buffer;
+}
+
+static void compareGlyphs(const Font &parsed, const Font &compiled) {
+    for (int g = 0; g < checkFont.glyphCount; g++) {
+        const uint32_t id = checkFont.glyphs[g].id;
+        const FontChar a = parsed.getCharacter(id);
+        const FontChar b = compiled.getCharacter(id);
+        CHECK(a.id == id && b.id == id);
+        CHECK(a.width == b.width && a.height == b.height);
+        CHECK(a.xoffset == b.xoffset && a.yoffset == b.yoffset && a.xadvance == b.xadvance);
+
+        // The compiled sheet is repacked, so pixels are compared through each font's own x, y
+        int differences = 0;
+        for (int y = 0; y < a.height; y++) {
+            for (int x = 0; x < a.width; x++) {
+                const bool inkA = parsed.getPixel(a.x + x, a.y + y).b <= 1;
+                const bool inkB = compiled.getPixel(b.x + x, b.y + y).b <= 1;
+                differences += inkA != inkB;
+            }
+        }
+        CHECK(differences == 0);
+
+        for (int g2 = 0; g2 < checkFont.glyphCount; g2++) {
+            const uint32_t second = checkFont.glyphs[g2].id;
+            CHECK(parsed.getKerning(id, second) == compiled.getKerning(id, second));
+        }
+    }
+}
+
+static void testFont() {
+    Font parsed(Image::asImage(&checkFont_rgb565), checkFont_descriptor);
+    Font compiled(checkFont);
+    CHECK(checkFont.kerningCount > 0);
+    compareGlyphs(parsed, compiled);
+
+    for (float scale : { 1.0f, 2.0f, 3.0f }) {
+        parsed.setScale(scale);
+        compiled.setScale(scale);
+
+        Renderer a(WIDTH, HEIGHT);
+        Renderer b(WIDTH, HEIGHT);
+        for (Renderer *r : { &a, &b }) {
+            r->setFont(r == &a ? &parsed : &compiled);
+            int y = 20;
+            for (const char *text : SAMPLES) {
+                r->setColor(DisplayColor::BLACK);
+                r->drawText(10, y, text);
+                r->setColor(DisplayColor::RED);
+                r->drawText(WIDTH - 10, y + 5, text, TextAlignment::RIGHT);
+                y += 30 * scale;
+            }
+
+            // Clipped across glyphs
+            r->setColor(DisplayColor::BLACK);
+            r->setClipRect(Rect(400, 0, 37, HEIGHT));
+            r->drawText(WIDTH / 2, 400, SAMPLES[0], TextAlignment::CENTER);
+            r->resetClipRect();
+        }
+        CHECK(planes(a) == planes(b));
+    }
+}
+
+static void testImage() {
+    Image parsed = Image::asImage(&checkFont_rgb565);
+    Image compiled = Image::fromBitmap(checkSheet);
+    CHECK(parsed.width == compiled.width && parsed.height == compiled.height);
+
+    for (float scale : { 1.0f, 2.0f, 2.5f }) {
+        parsed.setScale(scale);
+        compiled.setScale(scale);
+
+        Renderer a(WIDTH, HEIGHT);
+        Renderer b(WIDTH, HEIGHT);
+        for (Renderer *r : { &a, &b }) {
+            Image &image = r == &a ? parsed : compiled;
+            r->drawImage(image, 3, 5);
+            r->setColor(DisplayColor::RED);
+            r->drawImage(image, 301, 17);
+
+            // Partly off screen and clipped
+            r->setColor(DisplayColor::BLACK);
+            r->drawImage(image, WIDTH - 40, HEIGHT - 30);
+            r->setClipRect(Rect(500, 300, 21, 13));
+            r->drawImage(image, 495, 290);
+            r->resetClipRect();
+        }
+        CHECK(planes(a) == planes(b));
+    }
+}
+
+int main() {
+    testFont();
+    testImage();
+    return testResult();
+}
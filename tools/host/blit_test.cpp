@@ -0,0 +1,156 @@
+// blit() and blitMasked() against a per-pixel reference, at every source and destination bit
+// offset with every raster op, for widths around the byte and word sizes, clipped at the edges,
+// within one matrix and into sparse matrices.
+
+#include "binary_matrix.h"
+#include "tile_pool.h"
+
+#include <vector>
+
+#include "host_test.h"
+
+static const RasterOp OPS[] = { ROP_COPY, ROP_OR, ROP_AND, ROP_XOR, ROP_AND_NOT };
+static const int WIDTHS[] = { 1, 2, 5, 7, 8, 9, 15, 16, 17, 24, 31, 32, 33, 40, 63, 64, 65, 97, 120 };
+
+// A matrix as one byte per pixel
+struct Pixels {
+    int width;
+    int height;
+    std::vector<uint8_t> values;
+
+    Pixels(const BinaryMatrix &m) : width(m.width), height(m.height), values(m.width * m.height) {
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) values[y * width + x] = m.getPixel(x, y);
+        }
+    }
+
+    uint8_t &at(int x, int y) {
+        return values[y * width + x];
+    }
+
+    bool contains(int x, int y) const {
+        return x >= 0 && y >= 0 && x < width && y < height;
+    }
+};
+
+static bool combine(bool dst, bool src, RasterOp rop) {
+    switch (rop) {
+        case ROP_COPY: return src;
+        case ROP_OR: return dst || src;
+        case ROP_AND: return dst && src;
+        case ROP_XOR: return dst != src;
+        case ROP_AND_NOT: return dst && !src;
+    }
+    return dst;
+}
+
+// What blit() or blitMasked() does to dst, pixel by pixel; src and dst may be the same pixels
+static void referenceBlit(const Pixels &src, const Pixels *mask, Rect srcRect, Pixels &dst, int x, int y, RasterOp rop) {
+    const Pixels before = src;
+    for (int j = 0; j < srcRect.height; j++) {
+        for (int i = 0; i < srcRect.width; i++) {
+            const int sx = srcRect.x + i;
+            const int sy = srcRect.y + j;
+            if (!before.contains(sx, sy) || !dst.contains(x + i, y + j)) continue;
+            if (mask != nullptr && !mask->values[sy * mask->width + sx]) continue;
+
+            uint8_t &d = dst.at(x + i, y + j);
+            d = combine(d, before.values[sy * before.width + sx], rop);
+        }
+    }
+}
+
+static void randomize(BinaryMatrix &m) {
+    for (int y = 0; y < m.height; y++) {
+        for (int x = 0; x < m.width; x++) m.setPixel(x, y, rand() % 2);
+    }
+}
+
+static bool matches(const BinaryMatrix &m, const Pixels &pixels) {
+    return Pixels(m).values == pixels.values;
+}
+
+// Every source bit offset against every destination bit offset, every op and width
+static void testOffsets(TilePool *pool) {
+    BinaryMatrix src(150, 12);
+    BinaryMatrix mask(150, 12);
+    BinaryMatrix dst(160, 16, pool);
+    randomize(src);
+    randomize(mask);
+    const Pixels srcPixels(src);
+    const Pixels maskPixels(mask);
+
+    int failures = 0;
+    for (int srcBit = 0; srcBit < 8; srcBit++) {
+        for (int dstBit = 0; dstBit < 8; dstBit++) {
+            for (int width : WIDTHS) {
+                const Rect srcRect(8 * (rand() % 2) + srcBit, rand() % 4, width, 1 + rand() % 8);
+                const int x = 8 * (rand() % 2) + dstBit;
+                const int y = rand() % 8;
+
+                for (int op = 0; op <= (int) (sizeof(OPS) / sizeof(OPS[0])); op++) {
+                    // The last pass is blitMasked
+                    const bool masked = op == sizeof(OPS) / sizeof(OPS[0]);
+                    const RasterOp rop = masked ? ROP_COPY : OPS[op];
+
+                    randomize(dst);
+                    Pixels expected(dst);
+                    if (masked) {
+                        blitMasked(src, mask, srcRect, dst, x, y);
+                        referenceBlit(srcPixels, &maskPixels, srcRect, expected, x, y, rop);
+                    } else {
+                        blit(src, srcRect, dst, x, y, rop);
+                        referenceBlit(srcPixels, nullptr, srcRect, expected, x, y, rop);
+                    }
+
+                    if (!matches(dst, expected) && failures++ < 5) {
+                        printf("%s: src bit %d, dst bit %d, width %d, op %d differs\n", masked ? "blitMasked" : "blit",
+                            srcBit, dstBit, width, op);
+                    }
+                }
+            }
+        }
+    }
+    CHECK(failures == 0);
+}
+
+// Rects partly outside the source or the destination, and blits within one matrix
+static void testClippedAndOverlapping() {
+    BinaryMatrix src(70, 30);
+    BinaryMatrix dst(90, 40);
+    int failures = 0;
+
+    for (int i = 0; i < 3000; i++) {
+        const bool same = i % 3 == 0;
+        BinaryMatrix &target = same ? src : dst;
+        randomize(src);
+        if (!same) randomize(dst);
+
+        const Rect srcRect(rand() % 90 - 10, rand() % 40 - 5, rand() % 80, rand() % 30);
+        const int x = rand() % 110 - 20;
+        const int y = rand() % 50 - 10;
+        const RasterOp rop = OPS[rand() % 5];
+
+        const Pixels srcPixels(src);
+        Pixels expected(target);
+        blit(src, srcRect, target, x, y, rop);
+        referenceBlit(srcPixels, nullptr, srcRect, expected, x, y, rop);
+
+        if (!matches(target, expected) && failures++ < 5) {
+            printf("blit%s: rect (%d,%d,%d,%d) to (%d,%d), op %d differs\n", same ? " within" : "",
+                srcRect.x, srcRect.y, srcRect.width, srcRect.height, x, y, rop);
+        }
+    }
+    CHECK(failures == 0);
+}
+
+int main() {
+    srand(31);
+    testOffsets(nullptr);
+
+    TilePool pool(BinaryMatrix::tileBytes(160));
+    testOffsets(&pool);
+
+    testClippedAndOverlapping();
+    return testResult();
+}
@@ -0,0 +1,201 @@
+// Fill patterns: BinaryMatrix::fillSpan against a per-pixel reference, patterned shapes against
+// the same shapes drawn solid, with the pattern anchored to the screen, and the density and
+// spread of the gray levels and hatches.
+
+#include "fill_pattern.h"
+#include "renderer.h"
+#include "snapshot.h"
+#include "tile_pool.h"
+
+#include <vector>
+
+#include "host_test.h"
+
+static const int WIDTH = 880;
+static const int HEIGHT = 528;
+
+static bool patternBit(const FillPattern &pattern, int x, int y) {
+    return pattern.row(y) & (0x80 >> (x & 7));
+}
+
+static int density(const FillPattern &pattern) {
+    int set = 0;
+    for (int y = 0; y < 8; y++) {
+        for (int x = 0; x < 8; x++) set += patternBit(pattern, x, y);
+    }
+    return set;
+}
+
+static void testFillSpan(TilePool *pool) {
+    const int width = 200;
+    const int height = 40;
+    BinaryMatrix matrix(width, height, pool);
+    std::vector<uint8_t> pixels(width * height);
+
+    srand(35);
+    for (int i = 0; i < 5000; i++) {
+        const uint16_t y = rand() % height;
+        const uint16_t x0 = rand() % width;
+        const uint16_t x1 = x0 + rand() % (width - x0 + 1);
+        const bool value = rand() % 2;
+        const uint8_t pattern = rand() % 3 == 0 ? 0xFF : rand();
+
+        matrix.fillSpan(y, x0, x1, value, pattern);
+        for (int x = x0; x < x1; x++) {
+            if (pattern & (0x80 >> (x & 7))) pixels[y * width + x] = value;
+        }
+    }
+
+    bool same = true;
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            if (matrix.getPixel(x, y) != (bool) pixels[y * width + x]) same = false;
+        }
+    }
+    CHECK(same);
+}
+
+static void loadPlanes(const Renderer &renderer, BinaryMatrix &black, BinaryMatrix &red) {
+    std::vector<uint8_t> buffer(2 * WIDTH / 8 * HEIGHT + 1024);
+    MemorySink sink(buffer.data(), buffer.size());
+    CHECK(renderer.saveSnapshot(sink));
+    MemorySource source(buffer.data(), sink.size());
+    CHECK(loadSnapshot(black, red, source));
+}
+
+// Draws the same shapes solid and with the pattern. A pixel is set in the patterned planes
+// exactly where it is set in the solid ones and the pattern has it at its screen position,
+// wherever the shape starts.
+static void testAnchored(const FillPattern &pattern, bool clear) {
+    Renderer solid(WIDTH, HEIGHT);
+    Renderer patterned(WIDTH, HEIGHT);
+
+    for (Renderer *r : { &solid, &patterned }) {
+        if (clear) {
+            r->setColor(DisplayColor::BLACK);
+            r->fillRect(0, 0, WIDTH, HEIGHT);
+            r->setClearMode();
+        }
+        r->setFillPattern(r == &solid ? FillPattern() : pattern);
+
+        for (int i = 0; i < 8; i++) {
+            r->fillRect(13 + 100 * i + i, 20 + i, 60 + i, 50 - i);
+            r->fillCircle(40 + 100 * i, 140 + i, 25 + i);
+            r->fillRoundRect(10 + 100 * i + i, 200 + 3 * i, 70, 60, 4 + i);
+            r->fillTriangle(20 + 100 * i, 300 + i, 90 + 100 * i - i, 320, 30 + 100 * i, 380 + 2 * i);
+        }
+        r->setColor(DisplayColor::RED);
+        r->fillPie(440, 460, 60, 30, 300);
+    }
+
+    BinaryMatrix solidBlack(WIDTH, HEIGHT);
+    BinaryMatrix solidRed(WIDTH, HEIGHT);
+    BinaryMatrix black(WIDTH, HEIGHT);
+    BinaryMatrix red(WIDTH, HEIGHT);
+    loadPlanes(solid, solidBlack, solidRed);
+    loadPlanes(patterned, black, red);
+
+    int mismatches = 0;
+    int shapePixels = 0;
+    for (int y = 0; y < HEIGHT; y++) {
+        for (int x = 0; x < WIDTH; x++) {
+            const bool bit = patternBit(pattern, x, y);
+            // In clear mode the shape is where the solid planes were cleared
+            const bool inBlack = solidBlack.getPixel(x, y) != clear;
+            const bool inRed = solidRed.getPixel(x, y);
+            shapePixels += inBlack + inRed;
+
+            const bool expectedBlack = clear ? !(inBlack && bit) : inBlack && bit;
+            if (black.getPixel(x, y) != expectedBlack) mismatches++;
+            if (red.getPixel(x, y) != (inRed && bit)) mismatches++;
+        }
+    }
+    CHECK(shapePixels > 0);
+    CHECK(mismatches == 0);
+}
+
+static void testGrayLevels() {
+    CHECK(density(FillPattern::gray(0)) == 0);
+    CHECK(FillPattern::gray(FillPattern::GRAY_LEVELS).isSolid());
+    CHECK(FillPattern().isSolid());
+    CHECK(!FillPattern::gray(FillPattern::GRAY_LEVELS - 1).isSolid());
+
+    for (int level = 0; level <= FillPattern::GRAY_LEVELS; level++) {
+        const FillPattern pattern = FillPattern::gray(level);
+        CHECK(density(pattern) == level);
+
+        for (int y = 0; y < 8; y++) {
+            for (int x = 0; x < 8; x++) {
+                CHECK(patternBit(pattern, x, y) == (FillPattern::bayer(x, y) < level));
+            }
+        }
+
+        // Each level adds pixels to the one below
+        if (level > 0) {
+            const FillPattern lower = FillPattern::gray(level - 1);
+            for (int y = 0; y < 8; y++) CHECK((lower.rows[y] & ~pattern.rows[y]) == 0);
+        }
+
+        // Spread evenly: every quadrant of the tile gets its share, and every 2x2 cell at the
+        // levels that are a multiple of 16
+        if (level % 4 == 0) {
+            for (int q = 0; q < 4; q++) {
+                int set = 0;
+                for (int y = 0; y < 4; y++) {
+                    for (int x = 0; x < 4; x++) set += patternBit(pattern, x + q % 2 * 4, y + q / 2 * 4);
+                }
+                CHECK(set == level / 4);
+            }
+        }
+        if (level % 16 == 0) {
+            for (int cy = 0; cy < 8; cy += 2) {
+                for (int cx = 0; cx < 8; cx += 2) {
+                    const int set = patternBit(pattern, cx, cy) + patternBit(pattern, cx + 1, cy)
+                        + patternBit(pattern, cx, cy + 1) + patternBit(pattern, cx + 1, cy + 1);
+                    CHECK(set == level / 16);
+                }
+            }
+        }
+    }
+
+    // Out of range levels are clamped by the comparison
+    CHECK(density(FillPattern::gray(-5)) == 0);
+    CHECK(FillPattern::gray(100).isSolid());
+}
+
+static void testHatches() {
+    for (int y = 0; y < 16; y++) {
+        for (int x = 0; x < 16; x++) {
+            const bool horizontal = y % 8 == 0;
+            const bool vertical = x % 8 == 0;
+            const bool diagonal = (x + y) % 8 == 7;     // up and to the right, y grows downwards
+            const bool antiDiagonal = x % 8 == y % 8;
+            CHECK(patternBit(FillPattern::hatch(HATCH_HORIZONTAL), x, y) == horizontal);
+            CHECK(patternBit(FillPattern::hatch(HATCH_VERTICAL), x, y) == vertical);
+            CHECK(patternBit(FillPattern::hatch(HATCH_DIAGONAL), x, y) == diagonal);
+            CHECK(patternBit(FillPattern::hatch(HATCH_ANTI_DIAGONAL), x, y) == antiDiagonal);
+            CHECK(patternBit(FillPattern::hatch(HATCH_CROSS), x, y) == (horizontal || vertical));
+            CHECK(patternBit(FillPattern::hatch(HATCH_DIAGONAL_CROSS), x, y) == (diagonal || antiDiagonal));
+        }
+    }
+    CHECK(density(FillPattern::hatch(HATCH_CROSS)) == 15);
+    CHECK(density(FillPattern::hatch(HATCH_DIAGONAL_CROSS)) == 16);
+}
+
+int main() {
+    testFillSpan(nullptr);
+    TilePool pool(BinaryMatrix::tileBytes(200));
+    testFillSpan(&pool);
+
+    testGrayLevels();
+    testHatches();
+
+    const uint8_t checker[8] = { 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55 };
+    testAnchored(FillPattern::gray(10), false);
+    testAnchored(FillPattern::gray(37), false);
+    testAnchored(FillPattern::gray(52), true);
+    testAnchored(FillPattern::hatch(HATCH_DIAGONAL), false);
+    testAnchored(FillPattern::hatch(HATCH_CROSS), true);
+    testAnchored(FillPattern(checker), false);
+    return testResult();
+}
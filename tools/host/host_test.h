@@ -0,0 +1,25 @@
+#ifndef host_test_h
+#define host_test_h
+
+#include <stdio.h>
+
+/*
+ * Checks for the host tests. A failed CHECK prints where it failed and the test goes on; main()
+ * returns testResult(), so make test stops at the first test with a failure.
+ */
+
+static int testFailures = 0;
+
+#define CHECK(condition) do { \
+        if (!(condition)) { \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            testFailures++; \
+        } \
+    } while (0)
+
+static inline int testResult() {
+    printf(testFailures == 0 ? "ok\n" : "%d check(s) failed\n", testFailures);
+    return testFailures == 0 ? 0 : 1;
+}
+
+#endif
@@ -0,0 +1,188 @@
+// Orientation: PanelRowReader and toPanelRect against a per-pixel mapping of logical to panel
+// coordinates for every rotation with and without mirroring, and the panel RAM of the emulator
+// after full and partial renders of a rotated renderer.
+
+#include "orientation.h"
+#include "renderer.h"
+#include "snapshot.h"
+
+#include <vector>
+
+#include "host_test.h"
+
+static const int PANEL_WIDTH = 880;
+static const int PANEL_HEIGHT = 528;
+
+static const Orientation ORIENTATIONS[] = {
+    Orientation(ROTATE_0), Orientation(ROTATE_90), Orientation(ROTATE_180), Orientation(ROTATE_270),
+    Orientation(ROTATE_0, true), Orientation(ROTATE_90, true), Orientation(ROTATE_180, true), Orientation(ROTATE_270, true),
+};
+
+// Panel pixel of logical pixel (lx, ly): rotated clockwise, then mirrored horizontally
+static void toPanel(Orientation orientation, int lx, int ly, int &px, int &py) {
+    px = lx;
+    py = ly;
+    switch (orientation.rotation) {
+        case ROTATE_0: break;
+        case ROTATE_90: px = PANEL_WIDTH - 1 - ly; py = lx; break;
+        case ROTATE_180: px = PANEL_WIDTH - 1 - lx; py = PANEL_HEIGHT - 1 - ly; break;
+        case ROTATE_270: px = ly; py = PANEL_HEIGHT - 1 - lx; break;
+    }
+    if (orientation.mirror) px = PANEL_WIDTH - 1 - px;
+}
+
+static int logicalWidth(Orientation orientation) {
+    return orientation.swapsAxes() ? PANEL_HEIGHT : PANEL_WIDTH;
+}
+
+static int logicalHeight(Orientation orientation) {
+    return orientation.swapsAxes() ? PANEL_WIDTH : PANEL_HEIGHT;
+}
+
+// The frame as the panel should show it, one byte per pixel
+static std::vector<uint8_t> panelPixels(const BinaryMatrix &frame, Orientation orientation) {
+    std::vector<uint8_t> pixels(PANEL_WIDTH * PANEL_HEIGHT);
+    for (int ly = 0; ly < frame.height; ly++) {
+        for (int lx = 0; lx < frame.width; lx++) {
+            int px, py;
+            toPanel(orientation, lx, ly, px, py);
+            pixels[py * PANEL_WIDTH + px] = frame.getPixel(lx, ly);
+        }
+    }
+    return pixels;
+}
+
+static bool bit(const uint8_t *bytes, int x) {
+    return bytes[x / 8] & (0x80 >> (x % 8));
+}
+
+static void testReader(Orientation orientation) {
+    BinaryMatrix frame(logicalWidth(orientation), logicalHeight(orientation));
+    for (int y = 0; y < frame.height; y++) {
+        for (int i = 0; i < frame.stride; i++) frame.rowData(y)[i] = rand();
+    }
+    const std::vector<uint8_t> expected = panelPixels(frame, orientation);
+
+    PanelRowReader reader(frame, orientation);
+    CHECK(reader.panelWidth() == PANEL_WIDTH);
+    CHECK(reader.panelHeight() == PANEL_HEIGHT);
+
+    // Whole rows in order, as writePartial sends a full frame
+    uint8_t row[PANEL_WIDTH / 8];
+    int mismatches = 0;
+    for (int y = 0; y < PANEL_HEIGHT; y++) {
+        reader.read(y, 0, PANEL_WIDTH / 8, row);
+        for (int x = 0; x < PANEL_WIDTH; x++) {
+            if (bit(row, x) != (bool) expected[y * PANEL_WIDTH + x]) mismatches++;
+        }
+    }
+
+    // Byte ranges of rows in any order, which move the strip between reads
+    for (int i = 0; i < 2000; i++) {
+        const int y = rand() % PANEL_HEIGHT;
+        const int byteX0 = rand() % (PANEL_WIDTH / 8);
+        const int byteX1 = byteX0 + 1 + rand() % (PANEL_WIDTH / 8 - byteX0);
+        reader.read(y, byteX0, byteX1, row);
+        for (int x = byteX0 * 8; x < byteX1 * 8; x++) {
+            if (bit(row, x - byteX0 * 8) != (bool) expected[y * PANEL_WIDTH + x]) mismatches++;
+        }
+    }
+    CHECK(mismatches == 0);
+}
+
+// The panel rect of a logical rect covers exactly the panel pixels of its logical pixels
+static void testPanelRect(Orientation orientation) {
+    const int width = logicalWidth(orientation);
+    const int height = logicalHeight(orientation);
+
+    for (int i = 0; i < 500; i++) {
+        const int lx = rand() % width;
+        const int ly = rand() % height;
+        const int lw = 1 + rand() % (width - lx);
+        const int lh = 1 + rand() % (height - ly);
+
+        // The corners are enough, as the mapping is affine
+        int minX = PANEL_WIDTH, minY = PANEL_HEIGHT, maxX = -1, maxY = -1;
+        for (int corner = 0; corner < 4; corner++) {
+            int px, py;
+            toPanel(orientation, lx + (corner & 1) * (lw - 1), ly + (corner >> 1) * (lh - 1), px, py);
+            minX = min(minX, px);
+            minY = min(minY, py);
+            maxX = max(maxX, px);
+            maxY = max(maxY, py);
+        }
+
+        int x = lx, y = ly, w = lw, h = lh;
+        orientation.toPanelRect(width, height, x, y, w, h);
+        CHECK(x == minX && y == minY && w == maxX - minX + 1 && h == maxY - minY + 1);
+    }
+}
+
+static void loadPlanes(const Renderer &renderer, BinaryMatrix &black, BinaryMatrix &red) {
+    std::vector<uint8_t> buffer(2 * PANEL_WIDTH / 8 * PANEL_HEIGHT + 1024);
+    MemorySink sink(buffer.data(), buffer.size());
+    CHECK(renderer.saveSnapshot(sink));
+    MemorySource source(buffer.data(), sink.size());
+    CHECK(loadSnapshot(black, red, source));
+}
+
+static bool ramMatches(const uint8_t *ram, const std::vector<uint8_t> &pixels, bool invert) {
+    for (int y = 0; y < PANEL_HEIGHT; y++) {
+        for (int x = 0; x < PANEL_WIDTH; x++) {
+            if (bit(ram + y * PANEL_WIDTH / 8, x) != (pixels[y * PANEL_WIDTH + x] != invert)) return false;
+        }
+    }
+    return true;
+}
+
+// A full render, then partial renders of small changes, each leave the panel RAM showing the
+// frame in the orientation of the renderer
+static void testRender(Orientation orientation) {
+    const EInkConfig config(PANEL_WIDTH, PANEL_HEIGHT);
+    Renderer renderer(config, orientation.rotation, orientation.mirror);
+    renderer.setPartialTransfer(true);
+    const int width = renderer.getWidth();
+    const int height = renderer.getHeight();
+    CHECK(width == logicalWidth(orientation) && height == logicalHeight(orientation));
+
+    BinaryMatrix black(width, height);
+    BinaryMatrix red(width, height);
+    for (int frame = 0; frame < 6; frame++) {
+        const int rects = frame == 0 ? 30 : 1 + rand() % 3;
+        for (int i = 0; i < rects; i++) {
+            renderer.setColor(rand() % 3 == 0 ? DisplayColor::RED : DisplayColor::BLACK);
+            if (rand() % 4 == 0) renderer.setClearMode(); else renderer.setDrawMode();
+            renderer.fillRect(rand() % width - 10, rand() % height - 10, 1 + rand() % 120, 1 + rand() % 80);
+        }
+        renderer.render();
+
+        loadPlanes(renderer, black, red);
+        const EmulatorTransport &panel = renderer.getDisplay().transport();
+        CHECK(ramMatches(panel.blackRam(), panelPixels(black, orientation), config.panel->invertBlack));
+        CHECK(ramMatches(panel.redRam(), panelPixels(red, orientation), false));
+    }
+}
+
+int main() {
+    srand(30);
+
+    uint8_t block[8];
+    uint8_t transposed[8];
+    for (int i = 0; i < 8; i++) block[i] = rand();
+    transpose8x8(block, transposed);
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) CHECK(bit(&transposed[j], i) == bit(&block[i], j));
+    }
+    for (int b = 0; b < 256; b++) {
+        uint8_t reversed = 0;
+        for (int i = 0; i < 8; i++) reversed |= ((b >> i) & 1) << (7 - i);
+        CHECK(reverseBits(b) == reversed);
+    }
+
+    for (Orientation orientation : ORIENTATIONS) {
+        testReader(orientation);
+        testPanelRect(orientation);
+        testRender(orientation);
+    }
+    return testResult();
+}
@@ -0,0 +1,167 @@
+// scanPolygon against a brute-force point-in-polygon test of every pixel center, for random
+// polygons with one or several contours under both fill rules.
+
+#include "polygon.h"
+
+#include <vector>
+
+#include "host_test.h"
+
+static const int SIZE = 128;
+
+struct Grid {
+    std::vector<uint8_t> hits;
+    bool overlap = false;
+    bool outside = false;
+    Rect clip;
+};
+
+static void collectSpan(void *context, int y, int x0, int x1) {
+    Grid &grid = *(Grid*) context;
+    if (y < grid.clip.y || y >= grid.clip.y + grid.clip.height || x0 < grid.clip.x
+            || x1 > grid.clip.x + grid.clip.width || x0 >= x1) {
+        grid.outside = true;
+        return;
+    }
+    for (int x = x0; x < x1; x++) {
+        if (grid.hits[y * SIZE + x]) grid.overlap = true;
+        grid.hits[y * SIZE + x] = 1;
+    }
+}
+
+enum Inside { OUTSIDE, INSIDE, TIE };
+
+// Exact test of the center (px + 0.5, py + 0.5) with a ray to the left. An edge crosses the row
+// when the center is in [top, bottom), as in scanPolygon. A crossing exactly at the center is a
+// tie, which the fixed point scan may round either way.
+static Inside brute(const Point *points, const uint16_t *sizes, int contours, FillRule rule, int px, int py) {
+    int winding = 0;
+    int crossings = 0;
+    const Point *contour = points;
+    for (int c = 0; c < contours; c++) {
+        for (int i = 0; i < sizes[c]; i++) {
+            Point a = contour[i];
+            Point b = contour[(i + 1) % sizes[c]];
+            if (a.y == b.y) continue;
+
+            int direction = 1;
+            if (a.y > b.y) {
+                std::swap(a, b);
+                direction = -1;
+            }
+            if (py < a.y || py >= b.y) continue;
+
+            // Crossing and center, both times 4 * dy
+            const int64_t dy = b.y - a.y;
+            const int64_t crossing = 4 * dy * a.x + 2 * (int64_t) (b.x - a.x) * (2 * (py - a.y) + 1);
+            const int64_t center = 2 * dy * (2 * px + 1);
+            if (crossing == center) return TIE;
+            if (crossing < center) {
+                winding += direction;
+                crossings++;
+            }
+        }
+        contour += sizes[c];
+    }
+    const bool inside = rule == FILL_EVEN_ODD ? (crossings & 1) : winding != 0;
+    return inside ? INSIDE : OUTSIDE;
+}
+
+// Returns the pixels compared; mismatches are counted in testFailures
+static int compare(const Point *points, const uint16_t *sizes, int contours, FillRule rule, Rect clip) {
+    Grid grid;
+    grid.hits.assign(SIZE * SIZE, 0);
+    grid.clip = clip;
+    scanPolygon(points, sizes, contours, rule, clip, collectSpan, &grid);
+    CHECK(!grid.overlap);
+    CHECK(!grid.outside);
+
+    int compared = 0;
+    int mismatches = 0;
+    for (int y = 0; y < SIZE; y++) {
+        for (int x = 0; x < SIZE; x++) {
+            const bool inClip = x >= clip.x && x < clip.x + clip.width && y >= clip.y && y < clip.y + clip.height;
+            const Inside expected = inClip ? brute(points, sizes, contours, rule, x, y) : OUTSIDE;
+            if (expected == TIE) continue;
+            compared++;
+            if (grid.hits[y * SIZE + x] != (expected == INSIDE)) mismatches++;
+        }
+    }
+    CHECK(mismatches == 0);
+    return compared;
+}
+
+static void testRandom() {
+    srand(34);
+    long compared = 0;
+    long pixels = 0;
+    for (int n = 0; n < 2000; n++) {
+        // Up to 3 contours of 3 to 12 points, partly outside the grid. Edges are kept under 128
+        // rows, so the 16.16 stepping error stays below the distance of any crossing that is
+        // not a tie from a pixel center.
+        Point points[36];
+        uint16_t sizes[3];
+        const int contours = 1 + rand() % 3;
+        int count = 0;
+        for (int c = 0; c < contours; c++) {
+            sizes[c] = 3 + rand() % 10;
+            for (int i = 0; i < sizes[c]; i++) {
+                points[count].x = rand() % (SIZE + 40) - 20;
+                points[count].y = rand() % (SIZE - 4) + 2 - rand() % 2 * 4;
+                count++;
+            }
+        }
+
+        Rect clip(0, 0, SIZE, SIZE);
+        if (n % 4 == 0) clip = Rect(rand() % 40, rand() % 40, 20 + rand() % 68, 20 + rand() % 68);
+
+        const FillRule rule = n % 2 ? FILL_EVEN_ODD : FILL_NON_ZERO;
+        compared += compare(points, sizes, contours, rule, clip);
+        pixels += SIZE * SIZE;
+    }
+
+    // Ties are rare
+    CHECK(pixels - compared < pixels / 1000);
+}
+
+static void testRules() {
+    // A square with a hole of the same direction: even-odd cuts it out, non-zero fills it
+    const Point ring[] = { { 10, 10 }, { 50, 10 }, { 50, 50 }, { 10, 50 }, { 20, 20 }, { 40, 20 }, { 40, 40 }, { 20, 40 } };
+    const uint16_t sizes[] = { 4, 4 };
+    const Rect clip(0, 0, SIZE, SIZE);
+
+    for (int r = 0; r < 2; r++) {
+        Grid grid;
+        grid.hits.assign(SIZE * SIZE, 0);
+        grid.clip = clip;
+        scanPolygon(ring, sizes, 2, r ? FILL_EVEN_ODD : FILL_NON_ZERO, clip, collectSpan, &grid);
+        CHECK(grid.hits[30 * SIZE + 30] == (r ? 0 : 1));
+        CHECK(grid.hits[15 * SIZE + 15] == 1);
+        compare(ring, sizes, 2, r ? FILL_EVEN_ODD : FILL_NON_ZERO, clip);
+    }
+
+    // A rectangle covers the same pixels as the rect
+    const Point rect[] = { { 3, 5 }, { 13, 5 }, { 13, 12 }, { 3, 12 } };
+    Grid grid;
+    grid.hits.assign(SIZE * SIZE, 0);
+    grid.clip = clip;
+    scanPolygon(rect, 4, FILL_NON_ZERO, clip, collectSpan, &grid);
+    int filled = 0;
+    for (uint8_t hit : grid.hits) filled += hit;
+    CHECK(filled == 10 * 7);
+    CHECK(grid.hits[5 * SIZE + 3] && grid.hits[11 * SIZE + 12] && !grid.hits[12 * SIZE + 12]);
+}
+
+static void testWideEdges() {
+    // Edges more than 32767 pixels wide, which overflow 32 bits in 16.16 fixed point
+    const Point points[] = { { -20000, 0 }, { 20000, 2 }, { 20000, 3 }, { -20000, 100 } };
+    const uint16_t size = 4;
+    compare(points, &size, 1, FILL_NON_ZERO, Rect(0, 0, SIZE, SIZE));
+}
+
+int main() {
+    testRandom();
+    testRules();
+    testWideEdges();
+    return testResult();
+}
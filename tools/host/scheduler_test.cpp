@@ -0,0 +1,107 @@
+// RenderScheduler driven by the panel emulator, with BUSY held for a while after every refresh.
+// Time only moves through delay(), which advances the clock without sleeping.
+
+#include "render_scheduler.h"
+#include "renderer.h"
+
+#include "host_test.h"
+
+static const uint32_t REFRESH_MS = 300;
+// BUSY, then the time the display lets the panel settle
+static const uint32_t BUSY_MS = REFRESH_MS + 200;
+static const uint32_t MIN_INTERVAL_MS = 1000;
+
+// Polls every millisecond until the scheduler fires; returns the time it fired
+static uint32_t pollUntilFired(RenderScheduler &scheduler, uint32_t limitMs = 5000) {
+    const uint32_t start = millis();
+    while (!scheduler.poll()) {
+        if (millis() - start > limitMs) {
+            CHECK(!"scheduler did not fire");
+            break;
+        }
+        delay(1);
+    }
+    return millis();
+}
+
+static void waitIdle(Renderer &renderer) {
+    while (renderer.isBusy()) delay(1);
+}
+
+int main() {
+    Renderer renderer(880, 528);
+    EmulatorTransport &panel = renderer.getDisplay().transport();
+    panel.setRefreshMs(REFRESH_MS);
+    const uint32_t activations = panel.activations();
+
+    RenderScheduler scheduler(renderer, MIN_INTERVAL_MS);
+    const Rect rect(10, 10, 100, 40);
+
+    // Requests are merged into one refresh, fired at the earliest deadline
+    uint32_t start = millis();
+    scheduler.request(rect, 500);
+    scheduler.request(rect, 100);
+    scheduler.request(rect, 800, PRIORITY_BACKGROUND);
+    CHECK(scheduler.hasPending());
+    CHECK(scheduler.msUntilDue() > 90 && scheduler.msUntilDue() <= 100);
+    uint32_t fired = pollUntilFired(scheduler);
+    CHECK(fired - start >= 100 && fired - start <= 102);
+    CHECK(!scheduler.hasPending());
+    CHECK(panel.activations() == activations + 1);
+    CHECK(scheduler.stats().requests == 3);
+    CHECK(scheduler.stats().refreshes == 1);
+    CHECK(scheduler.stats().coalesced == 2);
+    CHECK(scheduler.stats().deadlineMisses == 0);
+
+    // Nothing fires while the panel is busy. Normal requests that waited go out as soon as it is
+    // idle, and the minimum interval still applies. Every request whose deadline passed is a
+    // miss, not just the refresh.
+    CHECK(renderer.isBusy());
+    start = millis();
+    scheduler.request(rect, 10);
+    scheduler.request(rect, 20);
+    scheduler.request(rect, 30);
+    scheduler.request(rect, 5000);
+    fired = pollUntilFired(scheduler);
+    CHECK(fired - start >= MIN_INTERVAL_MS - 102);
+    CHECK(scheduler.stats().refreshes == 2);
+    CHECK(scheduler.stats().deadlineMisses == 3);
+    CHECK(scheduler.stats().maxLatencyMs >= MIN_INTERVAL_MS - 102);
+
+    // An urgent request is due at once, but waits for the refresh and the minimum interval
+    waitIdle(renderer);
+    delay(100);
+    start = millis();
+    scheduler.request(rect, 0, PRIORITY_URGENT);
+    CHECK(!scheduler.poll());
+    fired = pollUntilFired(scheduler);
+    CHECK(fired - start >= MIN_INTERVAL_MS - BUSY_MS - 102 - 1);
+    CHECK(scheduler.stats().deadlineMisses == 4);
+
+    // A background request made while the panel is busy waits for its deadline
+    CHECK(renderer.isBusy());
+    start = millis();
+    scheduler.request(rect, 3000, PRIORITY_BACKGROUND);
+    fired = pollUntilFired(scheduler);
+    CHECK(fired - start >= 3000 && fired - start <= 3002);
+    CHECK(scheduler.stats().deadlineMisses == 4);
+
+    // flush() waits for the panel and ignores deadline and interval
+    scheduler.request(rect, 10000);
+    scheduler.flush();
+    CHECK(!scheduler.hasPending());
+    CHECK(scheduler.stats().refreshes == 5);
+    CHECK(panel.activations() == activations + 5);
+    CHECK(scheduler.stats().deadlineMisses == 4);
+
+    // Without BUSY an async refresh still takes the time the panel needs to raise it and to settle
+    waitIdle(renderer);
+    panel.setRefreshMs(0);
+    start = millis();
+    renderer.invalidate(rect);
+    renderer.renderAsync();
+    waitIdle(renderer);
+    CHECK(millis() - start >= BUSY_MS - REFRESH_MS + 10);
+
+    return testResult();
+}
@@ -0,0 +1,81 @@
+// BinaryMatrix::scroll against a per-pixel reference, for random rects, offsets and fills on
+// dense and sparse matrices.
+
+#include "binary_matrix.h"
+#include "tile_pool.h"
+
+#include <vector>
+
+#include "host_test.h"
+
+static const int WIDTH = 200;
+static const int HEIGHT = 120;
+
+static void referenceScroll(std::vector<uint8_t> &pixels, Rect rect, int dx, int dy, bool fill) {
+    const std::vector<uint8_t> before = pixels;
+    for (int y = rect.y; y < rect.y + rect.height; y++) {
+        for (int x = rect.x; x < rect.x + rect.width; x++) {
+            const int sx = x - dx;
+            const int sy = y - dy;
+            const bool inside = sx >= rect.x && sx < rect.x + rect.width && sy >= rect.y && sy < rect.y + rect.height;
+            pixels[y * WIDTH + x] = inside ? before[sy * WIDTH + sx] : fill;
+        }
+    }
+}
+
+static bool matches(const BinaryMatrix &matrix, const std::vector<uint8_t> &pixels) {
+    for (int y = 0; y < HEIGHT; y++) {
+        for (int x = 0; x < WIDTH; x++) {
+            if (matrix.getPixel(x, y) != (bool) pixels[y * WIDTH + x]) return false;
+        }
+    }
+    return true;
+}
+
+static void testRandom(TilePool *pool) {
+    BinaryMatrix matrix(WIDTH, HEIGHT, pool);
+    std::vector<uint8_t> pixels(WIDTH * HEIGHT);
+
+    srand(38);
+    for (int i = 0; i < 3000; i++) {
+        // New content now and then, so there is something to move
+        if (i % 50 == 0) {
+            for (int y = 0; y < HEIGHT; y++) {
+                for (int x = 0; x < WIDTH; x++) {
+                    const bool value = (rand() % 3 == 0) || (y > 60 && x < 40);
+                    matrix.setPixel(x, y, value);
+                    pixels[y * WIDTH + x] = value;
+                }
+            }
+        }
+
+        const int x = rand() % WIDTH;
+        const int y = rand() % HEIGHT;
+        const Rect rect(x, y, 1 + rand() % (WIDTH - x), 1 + rand() % (HEIGHT - y));
+
+        // Mostly small steps, sometimes more than the rect, which leaves only fill
+        int dx = rand() % 4 == 0 ? 0 : rand() % 25 - 12;
+        int dy = rand() % 4 == 0 ? 0 : rand() % 9 - 4;
+        if (rand() % 20 == 0) {
+            dx = rand() % 2 ? WIDTH : -WIDTH;
+        }
+        const bool fill = rand() % 2;
+
+        matrix.scroll(rect, dx, dy, fill);
+        referenceScroll(pixels, rect, dx, dy, fill);
+
+        if (!matches(matrix, pixels)) {
+            printf("scroll %d: rect (%d,%d,%d,%d) by (%d,%d) differs\n", i, rect.x, rect.y, rect.width, rect.height, dx, dy);
+            testFailures++;
+            return;
+        }
+    }
+}
+
+int main() {
+    testRandom(nullptr);
+
+    TilePool pool(BinaryMatrix::tileBytes(WIDTH));
+    testRandom(&pool);
+    return testResult();
+}
@@ -0,0 +1,9 @@
+// Runs a sketch on the host: setup(), then loop() until the sketch calls exit()
+
+void setup();
+void loop();
+
+int main() {
+    setup();
+    while (true) loop();
+}
@@ -0,0 +1,182 @@
+// Snapshots: round-trips of dense and sparse planes through memory and files, and rejection of
+// snapshots of another size, corrupted or truncated ones.
+
+#include "snapshot.h"
+#include "tile_pool.h"
+
+#include <vector>
+
+#include "host_test.h"
+
+static const int WIDTH = 880;
+static const int HEIGHT = 528;
+
+static bool samePixels(const BinaryMatrix &a, const BinaryMatrix &b) {
+    for (int y = 0; y < a.height; y++) {
+        if (memcmp(a.rowData(y), b.rowData(y), a.stride) != 0) return false;
+    }
+    return true;
+}
+
+static bool isBlank(const BinaryMatrix &m) {
+    for (int y = 0; y < m.height; y++) {
+        for (int i = 0; i < m.stride; i++) {
+            if (m.rowData(y)[i] != 0) return false;
+        }
+    }
+    return true;
+}
+
+// Something like a dashboard: rects, a few lines of noise standing in for text, and a dither
+static void drawFrame(BinaryMatrix &black, BinaryMatrix &red, unsigned seed) {
+    srand(seed);
+    for (int i = 0; i < 20; i++) {
+        const int x = rand() % (WIDTH - 100);
+        const int y = rand() % (HEIGHT - 50);
+        black.setRect(x, y, 1 + rand() % 100, 1 + rand() % 50, rand() % 2);
+    }
+    for (int y = 300; y < 340; y++) {
+        for (int x = 20; x < 600; x++) {
+            if (rand() % 3 == 0) black.setPixel(x, y, true);
+        }
+    }
+    for (int y = 400; y < 500; y++) {
+        red.fillSpan(y, 100, 700, true, y % 2 ? 0xAA : 0x55);
+    }
+}
+
+static std::vector<uint8_t> save(const BinaryMatrix &black, const BinaryMatrix &red, SnapshotStats *stats = nullptr) {
+    std::vector<uint8_t> buffer(2 * WIDTH / 8 * HEIGHT + 1024);
+    MemorySink sink(buffer.data(), buffer.size());
+    CHECK(saveSnapshot(black, red, sink, stats));
+    buffer.resize(sink.size());
+    return buffer;
+}
+
+static void testRoundTrip() {
+    BinaryMatrix black(WIDTH, HEIGHT);
+    BinaryMatrix red(WIDTH, HEIGHT);
+    BinaryMatrix black2(WIDTH, HEIGHT);
+    BinaryMatrix red2(WIDTH, HEIGHT);
+
+    // A blank row is one run token
+    SnapshotStats stats;
+    std::vector<uint8_t> blank = save(black, red, &stats);
+    CHECK(stats.rawBytes == 2u * WIDTH / 8 * HEIGHT);
+    CHECK(stats.encodedBytes == blank.size());
+    CHECK(blank.size() < 2 * HEIGHT * 4);
+
+    for (unsigned seed = 1; seed <= 10; seed++) {
+        black.clear();
+        red.clear();
+        drawFrame(black, red, seed);
+
+        std::vector<uint8_t> data = save(black, red, &stats);
+        CHECK(stats.encodedBytes < stats.rawBytes);
+
+        black2.setRect(0, 0, WIDTH, HEIGHT, true);
+        MemorySource source(data.data(), data.size());
+        CHECK(loadSnapshot(black2, red2, source, &stats));
+        CHECK(samePixels(black, black2));
+        CHECK(samePixels(red, red2));
+    }
+
+    // Worst case: noise everywhere
+    srand(33);
+    for (int y = 0; y < HEIGHT; y++) {
+        for (int i = 0; i < black.stride; i++) black.rowData(y)[i] = rand();
+    }
+    std::vector<uint8_t> noise = save(black, red);
+    MemorySource source(noise.data(), noise.size());
+    CHECK(loadSnapshot(black2, red2, source));
+    CHECK(samePixels(black, black2));
+}
+
+static void testSparse() {
+    TilePool pool(BinaryMatrix::tileBytes(WIDTH));
+    BinaryMatrix black(WIDTH, HEIGHT);
+    BinaryMatrix red(WIDTH, HEIGHT);
+    drawFrame(black, red, 7);
+    std::vector<uint8_t> data = save(black, red);
+
+    // Loading into sparse planes leaves blank rows to uniform tiles
+    BinaryMatrix sparseBlack(WIDTH, HEIGHT, &pool);
+    BinaryMatrix sparseRed(WIDTH, HEIGHT, &pool);
+    MemorySource source(data.data(), data.size());
+    CHECK(loadSnapshot(sparseBlack, sparseRed, source));
+    CHECK(samePixels(black, sparseBlack));
+    CHECK(samePixels(red, sparseRed));
+
+    uint8_t fill;
+    CHECK(sparseRed.isRowUniform(0, fill) && fill == 0);
+
+    // And sparse planes save to the same bytes
+    CHECK(save(sparseBlack, sparseRed) == data);
+}
+
+static void testFile() {
+    BinaryMatrix black(WIDTH, HEIGHT);
+    BinaryMatrix red(WIDTH, HEIGHT);
+    drawFrame(black, red, 3);
+
+    FILE *file = tmpfile();
+    CHECK(file != nullptr);
+    if (file == nullptr) return;
+
+    FileSink sink(file);
+    CHECK(saveSnapshot(black, red, sink));
+    rewind(file);
+
+    BinaryMatrix black2(WIDTH, HEIGHT);
+    BinaryMatrix red2(WIDTH, HEIGHT);
+    FileSource source(file);
+    CHECK(loadSnapshot(black2, red2, source));
+    CHECK(samePixels(black, black2));
+    CHECK(samePixels(red, red2));
+    fclose(file);
+}
+
+static void testRejected() {
+    BinaryMatrix black(WIDTH, HEIGHT);
+    BinaryMatrix red(WIDTH, HEIGHT);
+    drawFrame(black, red, 5);
+    const std::vector<uint8_t> data = save(black, red);
+
+    BinaryMatrix black2(WIDTH, HEIGHT);
+    BinaryMatrix red2(WIDTH, HEIGHT);
+
+    // Another screen size
+    BinaryMatrix small(WIDTH / 2, HEIGHT);
+    BinaryMatrix smallRed(WIDTH / 2, HEIGHT);
+    MemorySource other(data.data(), data.size());
+    CHECK(!loadSnapshot(small, smallRed, other));
+    CHECK(isBlank(small));
+
+    // Any flipped bit is caught by the checksum or the decoder, and leaves blank planes
+    srand(34);
+    for (int i = 0; i < 50; i++) {
+        std::vector<uint8_t> corrupt = data;
+        corrupt[rand() % corrupt.size()] ^= 1 << (rand() % 8);
+
+        black2.setRect(0, 0, WIDTH, HEIGHT, true);
+        MemorySource source(corrupt.data(), corrupt.size());
+        CHECK(!loadSnapshot(black2, red2, source));
+        CHECK(isBlank(black2) && isBlank(red2));
+    }
+
+    // Truncated at any point
+    for (uint32_t size = 0; size < data.size(); size += 1 + data.size() / 50) {
+        black2.setRect(0, 0, WIDTH, HEIGHT, true);
+        MemorySource source(data.data(), size);
+        CHECK(!loadSnapshot(black2, red2, source));
+        CHECK(isBlank(black2));
+    }
+}
+
+int main() {
+    testRoundTrip();
+    testSparse();
+    testFile();
+    testRejected();
+    return testResult();
+}
@@ -0,0 +1,495 @@
+// ImageDecoder on small in-memory images: every PBM, PGM and BMP variant and RLE images against
+// the pixels they were written from, the three dither modes, and rejection of truncated and
+// malformed input.
+
+#include "renderer.h"
+#include "snapshot.h"
+#include "stream_image.h"
+
+#include <string>
+#include <vector>
+
+#include "host_test.h"
+
+// An image of index values 0 to levels - 1, which are grays from black to white
+struct TestImage {
+    int width;
+    int height;
+    int levels;
+    std::vector<uint16_t> index;
+
+    TestImage(int width, int height, int levels) : width(width), height(height), levels(levels), index(width * height) {
+        for (uint16_t &i : index) i = rand() % levels;
+    }
+
+    uint8_t gray(int x, int y) const {
+        return index[y * width + x] * 255 / (levels - 1);
+    }
+};
+
+typedef std::vector<uint8_t> Bytes;
+
+static void put(Bytes &out, const std::string &text) {
+    out.insert(out.end(), text.begin(), text.end());
+}
+
+static void putWord(Bytes &out, uint16_t value) {
+    out.push_back(value & 0xFF);
+    out.push_back(value >> 8);
+}
+
+static void putDword(Bytes &out, uint32_t value) {
+    putWord(out, value & 0xFFFF);
+    putWord(out, value >> 16);
+}
+
+// P1 or P4 of a 2 level image; index 0 is black, which is a 1 in PBM
+static Bytes makePbm(const TestImage &image, bool plain) {
+    Bytes out;
+    put(out, std::string(plain ? "P1" : "P4") + "\n# a comment\n" + std::to_string(image.width) + " "
+        + std::to_string(image.height) + "\n");
+    for (int y = 0; y < image.height; y++) {
+        uint8_t byte = 0;
+        for (int x = 0; x < image.width; x++) {
+            const bool black = image.index[y * image.width + x] == 0;
+            if (plain) {
+                // Digits with and without separators
+                put(out, black ? "1" : "0");
+                if (x % 3 == 0) put(out, " ");
+                continue;
+            }
+            if (black) byte |= 0x80 >> (x % 8);
+            if (x % 8 == 7 || x == image.width - 1) {
+                out.push_back(byte);
+                byte = 0;
+            }
+        }
+        if (plain) put(out, y % 2 ? "\n" : "\n# row comment\n");
+    }
+    return out;
+}
+
+// P2 or P5, with levels - 1 as the maximum value
+static Bytes makePgm(const TestImage &image, bool plain) {
+    const int maxValue = image.levels - 1;
+    Bytes out;
+    put(out, std::string(plain ? "P2" : "P5") + " " + std::to_string(image.width) + "\n" + std::to_string(image.height)
+        + "\t# size\n" + std::to_string(maxValue) + "\n");
+    for (int y = 0; y < image.height; y++) {
+        for (int x = 0; x < image.width; x++) {
+            const uint16_t value = image.index[y * image.width + x];
+            if (plain) {
+                put(out, std::to_string(value) + (x == image.width - 1 ? "\n" : " "));
+            } else if (maxValue > 255) {
+                out.push_back(value >> 8);
+                out.push_back(value & 0xFF);
+            } else {
+                out.push_back(value);
+            }
+        }
+    }
+    return out;
+}
+
+// Uncompressed BMP. Images for 1, 4 and 8 bits have 2, 16 and 256 levels and a gray palette
+// of that many entries; 16 bit images have 32 levels, one 555 channel value.
+static Bytes makeBmp(const TestImage &image, int bitsPerPixel, bool topDown, uint32_t extraInfo = 0) {
+    const uint32_t colors = bitsPerPixel <= 8 ? 1 << bitsPerPixel : 0;
+    const uint32_t rowBytes = (image.width * bitsPerPixel + 31) / 32 * 4;
+    const uint32_t dataOffset = 14 + 40 + extraInfo + 4 * colors;
+
+    Bytes out;
+    put(out, "BM");
+    putDword(out, dataOffset + rowBytes * image.height);
+    putDword(out, 0);
+    putDword(out, dataOffset);
+    putDword(out, 40 + extraInfo);
+    putDword(out, image.width);
+    putDword(out, topDown ? -image.height : image.height);
+    putWord(out, 1);
+    putWord(out, bitsPerPixel);
+    putDword(out, 0);
+    putDword(out, rowBytes * image.height);
+    putDword(out, 2835);
+    putDword(out, 2835);
+    putDword(out, colors);
+    putDword(out, 0);
+    out.insert(out.end(), extraInfo, 0xEE);
+
+    for (uint32_t i = 0; i < colors; i++) {
+        const uint8_t gray = i * 255 / (colors - 1);
+        out.push_back(gray);
+        out.push_back(gray);
+        out.push_back(gray);
+        out.push_back(0);
+    }
+
+    for (int r = 0; r < image.height; r++) {
+        const int y = topDown ? r : image.height - 1 - r;
+        Bytes row(rowBytes, 0);
+        for (int x = 0; x < image.width; x++) {
+            const uint16_t value = image.index[y * image.width + x];
+            const uint8_t gray = image.gray(x, y);
+            switch (bitsPerPixel) {
+                case 1: row[x / 8] |= value << (7 - x % 8); break;
+                case 4: row[x / 2] |= value << (x % 2 == 0 ? 4 : 0); break;
+                case 8: row[x] = value; break;
+                case 16: {
+                    const uint16_t c = (value << 10) | (value << 5) | value;
+                    row[2 * x] = c & 0xFF;
+                    row[2 * x + 1] = c >> 8;
+                    break;
+                }
+                case 24: row[3 * x] = row[3 * x + 1] = row[3 * x + 2] = gray; break;
+                case 32: row[4 * x] = row[4 * x + 1] = row[4 * x + 2] = gray; row[4 * x + 3] = 0xFF; break;
+            }
+        }
+        out.insert(out.end(), row.begin(), row.end());
+    }
+    return out;
+}
+
+// Ink of each pixel, one byte per pixel, as far as the image could be decoded
+struct Decoded {
+    bool begun = false;
+    bool failed = false;
+    int width = 0;
+    int height = 0;
+    int rows = 0;
+    bool rowsInOrder = true;
+    std::vector<uint8_t> ink;
+};
+
+static Decoded decode(const Bytes &data, Dither dither = DITHER_THRESHOLD, uint8_t threshold = 128) {
+    Decoded result;
+    MemorySource source(data.data(), data.size());
+    ImageDecoder decoder(source, dither, threshold);
+    result.begun = decoder.begin();
+    if (!result.begun) {
+        result.failed = decoder.failed();
+        return result;
+    }
+
+    result.width = decoder.info().width;
+    result.height = decoder.info().height;
+    // Pixels are kept for small images only; large ones are headers of images that aren't there
+    const bool keep = (long) result.width * result.height <= 1 << 20;
+    if (keep) result.ink.assign(result.width * result.height, 2);
+
+    std::vector<bool> seen(result.height);
+    const BinaryMatrix *row;
+    int y;
+    while ((row = decoder.nextRow(y)) != nullptr) {
+        if (y < 0 || y >= result.height || seen[y]) {
+            result.rowsInOrder = false;
+            break;
+        }
+        seen[y] = true;
+        for (int x = 0; x < result.width && keep; x++) result.ink[y * result.width + x] = row->getPixel(x, 0);
+        result.rows++;
+    }
+    result.failed = decoder.failed();
+    return result;
+}
+
+static bool sameInk(const Decoded &decoded, const TestImage &image, uint8_t threshold = 128) {
+    if (!decoded.begun || decoded.failed || decoded.rows != image.height || !decoded.rowsInOrder) return false;
+    if (decoded.width != image.width || decoded.height != image.height) return false;
+    for (int y = 0; y < image.height; y++) {
+        for (int x = 0; x < image.width; x++) {
+            if (decoded.ink[y * image.width + x] != (image.gray(x, y) < threshold)) return false;
+        }
+    }
+    return true;
+}
+
+// Every length short of validFrom fails, in begin() or in a row, and no row is read twice
+static void checkTruncated(const Bytes &data, uint32_t validFrom) {
+    int accepted = 0;
+    for (uint32_t size = 0; size < validFrom; size++) {
+        const Decoded decoded = decode(Bytes(data.begin(), data.begin() + size));
+        CHECK(decoded.rowsInOrder);
+        if (!decoded.failed || (decoded.begun && decoded.rows == decoded.height)) accepted++;
+    }
+    CHECK(accepted == 0);
+}
+
+// Binary formats end with the last pixel
+static void checkTruncated(const Bytes &data) {
+    checkTruncated(data, data.size());
+}
+
+// A plain file is complete once its last pixel is there, even in part: the last number may end
+// the file, and comments may follow it
+static uint32_t lastPixelEnd(const Bytes &data, bool pbm) {
+    uint32_t i = data.size();
+    if (pbm) {
+        while (data[i - 1] != '0' && data[i - 1] != '1') i--;
+        return i;
+    }
+    while (isspace(data[i - 1])) i--;
+    while (isdigit(data[i - 1])) i--;
+    return i + 1;
+}
+
+static void testFormats() {
+    for (int width : { 1, 7, 8, 9, 30 }) {
+        const int height = 1 + rand() % 6;
+
+        const TestImage twoLevels(width, height, 2);
+        const Bytes plainPbm = makePbm(twoLevels, true);
+        const Bytes rawPbm = makePbm(twoLevels, false);
+        CHECK(sameInk(decode(plainPbm), twoLevels));
+        CHECK(sameInk(decode(rawPbm), twoLevels));
+        checkTruncated(plainPbm, lastPixelEnd(plainPbm, true));
+        checkTruncated(rawPbm);
+
+        const TestImage grays(width, height, 16);
+        const Bytes plainPgm = makePgm(grays, true);
+        CHECK(sameInk(decode(plainPgm), grays));
+        checkTruncated(plainPgm, lastPixelEnd(plainPgm, false));
+
+        const TestImage bytes(width, height, 256);
+        const Bytes rawPgm = makePgm(bytes, false);
+        CHECK(sameInk(decode(rawPgm), bytes));
+        checkTruncated(rawPgm);
+
+        const TestImage words(width, height, 1001);
+        const Bytes wideP5 = makePgm(words, false);
+        CHECK(sameInk(decode(wideP5), words));
+        CHECK(sameInk(decode(wideP5, DITHER_THRESHOLD, 200), words, 200));
+
+        for (int bitsPerPixel : { 1, 4, 8, 16, 24, 32 }) {
+            const int levels = bitsPerPixel <= 8 ? 1 << bitsPerPixel : bitsPerPixel == 16 ? 32 : 256;
+            const TestImage image(width, height, levels);
+            for (bool topDown : { false, true }) {
+                const Bytes bmp = makeBmp(image, bitsPerPixel, topDown);
+                const Decoded decoded = decode(bmp);
+                CHECK(decoded.begun && decode(bmp).width == width);
+                CHECK(sameInk(decoded, image));
+                checkTruncated(bmp);
+            }
+
+            // A larger info header (V4, V5) is skipped
+            CHECK(sameInk(decode(makeBmp(image, bitsPerPixel, false, 68)), image));
+        }
+
+        BinaryMatrix matrix(width, height);
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) matrix.setPixel(x, y, rand() % 3 == 0);
+        }
+        Bytes rle(64 + 4 * width * height);
+        MemorySink sink(rle.data(), rle.size());
+        CHECK(saveRleImage(matrix, sink));
+        rle.resize(sink.size());
+
+        const Decoded decoded = decode(rle);
+        CHECK(decoded.begun && !decoded.failed && decoded.rows == height);
+        bool same = true;
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) same &= decoded.ink[y * width + x] == matrix.getPixel(x, y);
+        }
+        CHECK(same);
+        checkTruncated(rle);
+    }
+}
+
+// A flat gray as 64x64 P5
+static Bytes flatGray(uint8_t gray) {
+    TestImage image(64, 64, 256);
+    for (uint16_t &i : image.index) i = gray;
+    return makePgm(image, false);
+}
+
+static int inkCount(const Decoded &decoded) {
+    int count = 0;
+    for (uint8_t ink : decoded.ink) count += ink;
+    return count;
+}
+
+static void testDither() {
+    for (int gray : { 0, 1, 40, 64, 100, 128, 170, 200, 254, 255 }) {
+        const Bytes data = flatGray(gray);
+
+        // Ordered: the screen anchored pattern of FillPattern::gray() at the matching level
+        const Decoded ordered = decode(data, DITHER_ORDERED);
+        CHECK(ordered.rows == 64 && !ordered.failed);
+        const FillPattern pattern = FillPattern::gray(((255 - gray) * FillPattern::GRAY_LEVELS + 127) / 255);
+        bool matches = true;
+        for (int y = 0; y < 64; y++) {
+            for (int x = 0; x < 64; x++) {
+                const bool bit = pattern.row(y) & (0x80 >> (x & 7));
+                matches &= ordered.ink[y * 64 + x] == bit;
+            }
+        }
+        CHECK(matches);
+
+        // Diffusion: the ink covers the darkness of the gray, within a couple of percent
+        const Decoded diffused = decode(data, DITHER_DIFFUSION);
+        CHECK(diffused.rows == 64 && !diffused.failed);
+        const int expected = (255 - gray) * 64 * 64 / 255;
+        CHECK(abs(inkCount(diffused) - expected) <= 64 * 64 / 50);
+
+        // Threshold: all or nothing
+        CHECK(inkCount(decode(data)) == (gray < 128 ? 64 * 64 : 0));
+    }
+
+    // Black and white pass through every mode unchanged
+    const TestImage twoLevels(40, 10, 2);
+    const Bytes pbm = makePbm(twoLevels, false);
+    for (Dither dither : { DITHER_THRESHOLD, DITHER_ORDERED, DITHER_DIFFUSION }) {
+        CHECK(sameInk(decode(pbm, dither), twoLevels));
+    }
+}
+
+static bool rejected(const Bytes &data) {
+    const Decoded decoded = decode(data);
+    return !decoded.begun && decoded.failed;
+}
+
+static Bytes text(const char *s) {
+    return Bytes(s, s + strlen(s));
+}
+
+static void setDword(Bytes &data, int offset, uint32_t value) {
+    for (int i = 0; i < 4; i++) data[offset + i] = value >> (8 * i);
+}
+
+static void setWord(Bytes &data, int offset, uint16_t value) {
+    data[offset] = value & 0xFF;
+    data[offset + 1] = value >> 8;
+}
+
+static void testMalformed() {
+    CHECK(rejected(Bytes()));
+    CHECK(rejected(text("P")));
+    CHECK(rejected(text("P3 2 2 255\n")));          // color PNM
+    CHECK(rejected(text("GIF89a")));
+    CHECK(rejected(text("ERLX\x02\x00\x02\x00")));
+
+    // PNM headers
+    CHECK(rejected(text("P4 0 5\n")));
+    CHECK(rejected(text("P4 65536 1\n")));
+    CHECK(rejected(text("P4 99999999999 1\n")));
+    CHECK(rejected(text("P4 -3 1\n")));
+    CHECK(rejected(text("P4 3x 1\n")));
+    CHECK(rejected(text("P5 4 4 0\n")));
+    CHECK(rejected(text("P5 4 4 65536\n")));
+    CHECK(rejected(text("P2 4 4\n")));
+    CHECK(rejected(text("P1 # a comment without an end")));
+
+    // A P2 value above the maximum is clamped
+    const Decoded clamped = decode(text("P2 2 1 15\n99 0\n"));
+    CHECK(clamped.rows == 1 && !clamped.failed && clamped.ink[0] == 0 && clamped.ink[1] == 1);
+
+    // A P1 pixel that is not a digit ends the image
+    CHECK(decode(text("P1 2 1\n1 x")).failed);
+
+    const TestImage image(10, 4, 256);
+    const Bytes bmp = makeBmp(image, 8, false);
+    const int dataOffset = 10;
+    const int infoSize = 14;
+    const int width = 18;
+    const int height = 22;
+    const int bitsPerPixel = 28;
+    const int compression = 30;
+    const int colors = 46;
+
+    for (int depth : { 0, 2, 3, 5, 12, 48, 64 }) {
+        Bytes data = bmp;
+        setWord(data, bitsPerPixel, depth);
+        CHECK(rejected(data));
+    }
+
+    Bytes data = bmp;
+    setDword(data, compression, 1);             // RLE8
+    CHECK(rejected(data));
+    data = bmp;
+    setDword(data, compression, 3);             // bit fields
+    CHECK(rejected(data));
+
+    data = bmp;
+    setDword(data, infoSize, 12);               // OS/2 header
+    CHECK(rejected(data));
+    data = bmp;
+    setDword(data, infoSize, 0xFFFFFFF0);       // past the end of the file
+    CHECK(rejected(data));
+
+    for (int32_t size : { 0, -1, 65536, (int32_t) 0x80000000 }) {
+        data = bmp;
+        setDword(data, width, size);
+        CHECK(rejected(data));
+    }
+    for (int32_t size : { 0, 65536, -65536, (int32_t) 0x80000000 }) {
+        data = bmp;
+        setDword(data, height, size);
+        CHECK(rejected(data));
+    }
+
+    // Data that starts inside the header or the palette, or after the end of the file
+    for (uint32_t offset : { 0u, 20u, 54u, 54u + 1023u, 100000u }) {
+        data = bmp;
+        setDword(data, dataOffset, offset);
+        CHECK(rejected(data));
+    }
+
+    // Too many palette colors are capped at what the depth can index
+    data = bmp;
+    setDword(data, colors, 0xFFFFFFFF);
+    CHECK(sameInk(decode(data), image));
+
+    // A valid header with far more rows than the data holds
+    data = bmp;
+    setDword(data, width, 65535);
+    setDword(data, height, 65535);
+    const Decoded huge = decode(data);
+    CHECK(huge.begun && huge.failed && huge.rows == 0);
+}
+
+// Renderer::drawImage puts the decoded rows at their place, in the current color and clip
+static void testDraw() {
+    const TestImage image(37, 21, 2);
+    const Bytes bmp = makeBmp(image, 1, false);
+
+    Renderer renderer(880, 528);
+    renderer.setColor(DisplayColor::RED);
+    MemorySource source(bmp.data(), bmp.size());
+    CHECK(renderer.drawImage(source, 101, 53));
+
+    renderer.setColor(DisplayColor::BLACK);
+    renderer.setClipRect(Rect(0, 0, 20, 528));
+    const Bytes truncated(bmp.begin(), bmp.end() - 10);
+    MemorySource partial(truncated.data(), truncated.size());
+    CHECK(!renderer.drawImage(partial, 3, 5));
+    renderer.resetClipRect();
+
+    Bytes buffer(2 * 880 / 8 * 528 + 1024);
+    MemorySink sink(buffer.data(), buffer.size());
+    CHECK(renderer.saveSnapshot(sink));
+    BinaryMatrix black(880, 528);
+    BinaryMatrix red(880, 528);
+    MemorySource snapshot(buffer.data(), sink.size());
+    CHECK(loadSnapshot(black, red, snapshot));
+
+    bool same = true;
+    for (int y = 0; y < 528; y++) {
+        for (int x = 0; x < 880; x++) {
+            const bool inRed = x >= 101 && x < 101 + 37 && y >= 53 && y < 53 + 21;
+            same &= red.getPixel(x, y) == (inRed && image.gray(x - 101, y - 53) < 128);
+
+            // Bottom-up rows of 8 bytes: the cut removes the top two, which are read last
+            const bool inBlack = x >= 3 && x < 20 && y >= 5 + 2 && y < 5 + 21;
+            same &= black.getPixel(x, y) == (inBlack && image.gray(x - 3, y - 5) < 128);
+        }
+    }
+    CHECK(same);
+}
+
+int main() {
+    srand(42);
+    testFormats();
+    testDither();
+    testMalformed();
+    testDraw();
+    return testResult();
+}
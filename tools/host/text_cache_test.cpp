@@ -0,0 +1,131 @@
+// TextCache: a renderer drawing through a small cache gives the same planes as one drawing every
+// text glyph by glyph, over random draws, and a hit allocates nothing.
+
+#include "renderer.h"
+#include "text_cache.h"
+
+#include <new>
+#include <vector>
+
+#include "box_font.h"
+#include "host_test.h"
+
+static const int WIDTH = 880;
+static const int HEIGHT = 528;
+
+// Counts every allocation through operator new, e.g. of a std::string
+static long allocations = 0;
+
+void *operator new(std::size_t size) {
+    allocations++;
+    void *p = malloc(size);
+    if (p == nullptr) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void *p) noexcept {
+    free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+    free(p);
+}
+
+static std::vector<uint8_t> planes(const Renderer &renderer) {
+    std::vector<uint8_t> buffer(2 * WIDTH / 8 * HEIGHT + 1024);
+    MemorySink sink(buffer.data(), buffer.size());
+    CHECK(renderer.saveSnapshot(sink));
+    buffer.resize(sink.size());
+    return buffer;
+}
+
+static const char *TEXTS[] = {
+    "Temperature", "21.5 C", "AVWA", "Humidity 40%", "", " ", "Mon 12:45", "BWAV kerning",
+    // Longer than the small string buffer of std::string
+    "A label that is long enough to be stored on the heap by std::string",
+};
+
+static void testSamePlanes() {
+    BoxFont small = makeBoxFont(8, 12);
+    BoxFont large = makeBoxFont(24, 32);
+    Font smallFont(*small.image, small.descriptor);
+    Font largeFont(*large.image, large.descriptor);
+    Font scaledFont(*small.image, small.descriptor);
+    scaledFont.setScale(2.0f);
+    Font *fonts[] = { &smallFont, &largeFont, &scaledFont };
+
+    Renderer plain(WIDTH, HEIGHT);
+    Renderer cached(WIDTH, HEIGHT);
+    TextCache cache(8 * 1024);
+    cached.setTextCache(&cache);
+
+    char random[16];
+    srand(36);
+    for (int i = 0; i < 200; i++) {
+        const char *text = TEXTS[rand() % (sizeof(TEXTS) / sizeof(TEXTS[0]))];
+        if (rand() % 4 == 0) {
+            // A new string every time, so the cache misses and evicts
+            const int length = 1 + rand() % 12;
+            for (int c = 0; c < length; c++) random[c] = 32 + rand() % 95;
+            random[length] = 0;
+            text = random;
+        }
+
+        Font *font = fonts[rand() % 3];
+        const int x = rand() % (WIDTH + 200) - 100;
+        const int y = rand() % (HEIGHT + 40) - 20;
+        const TextAlignment align = (TextAlignment) (rand() % 3);
+        const DisplayColor color = rand() % 4 == 0 ? RED : BLACK;
+        const bool clear = rand() % 5 == 0;
+        const bool clip = rand() % 4 == 0;
+        const Rect clipRect(rand() % WIDTH, rand() % HEIGHT, rand() % 300, rand() % 100);
+
+        for (Renderer *r : { &plain, &cached }) {
+            r->setFont(font);
+            r->setColor(color);
+            if (clear) r->setClearMode(); else r->setDrawMode();
+            if (clip) r->setClipRect(clipRect); else r->resetClipRect();
+            r->drawText(x, y, text, align);
+        }
+    }
+
+    CHECK(planes(plain) == planes(cached));
+    CHECK(plain.getDirtyRegion().bounds().x == cached.getDirtyRegion().bounds().x);
+    CHECK(plain.getDirtyRegion().bounds().width == cached.getDirtyRegion().bounds().width);
+    CHECK(plain.getDirtyRegion().bounds().height == cached.getDirtyRegion().bounds().height);
+
+    CHECK(cache.hits() > 0);
+    CHECK(cache.misses() > 0);
+    CHECK(cache.evictions() > 0);
+    CHECK(cache.bytesUsed() <= cache.budget());
+}
+
+static void testHitAllocatesNothing() {
+    BoxFont small = makeBoxFont(8, 12);
+    Font font(*small.image, small.descriptor);
+    TextCache cache(64 * 1024);
+
+    const char *longText = TEXTS[sizeof(TEXTS) / sizeof(TEXTS[0]) - 1];
+    const TextCache::Text *first = cache.get(font, longText);
+    CHECK(first != nullptr);
+    cache.get(font, "21.5 C");
+
+    const long before = allocations;
+    for (int i = 0; i < 100; i++) {
+        CHECK(cache.get(font, i % 2 ? longText : "21.5 C") != nullptr);
+    }
+    CHECK(allocations == before);
+    CHECK(cache.get(font, longText) == first);
+    CHECK(cache.hits() == 101 && cache.misses() == 2);
+
+    // Another scale is another text
+    font.setScale(2.0f);
+    CHECK(cache.get(font, longText) != first);
+    CHECK(cache.misses() == 3);
+}
+
+int main() {
+    testSamePlanes();
+    testHitAllocatesNothing();
+    return testResult();
+}
@@ -0,0 +1,122 @@
+// Sparse BinaryMatrix storage: tile counts, and the same pixels as a dense matrix under random
+// writes.
+
+#include "binary_matrix.h"
+#include "tile_pool.h"
+
+#include "host_test.h"
+
+static const int WIDTH = 880;
+static const int HEIGHT = 528;
+
+static bool samePixels(const BinaryMatrix &a, const BinaryMatrix &b) {
+    for (int y = 0; y < a.height; y++) {
+        if (memcmp(a.rowData(y), b.rowData(y), a.stride) != 0) return false;
+    }
+    return true;
+}
+
+static uint32_t tilesOf(int y, int height) {
+    return (y + height - 1) / BinaryMatrix::TILE_ROWS - y / BinaryMatrix::TILE_ROWS + 1;
+}
+
+static void testTileCounts() {
+    TilePool pool(BinaryMatrix::tileBytes(WIDTH));
+    BinaryMatrix black(WIDTH, HEIGHT, &pool);
+    BinaryMatrix red(WIDTH, HEIGHT, &pool);
+    CHECK(black.isSparse() && red.isSparse());
+    CHECK(pool.tilesInUse() == 0);
+
+    // A mostly white frame with two filled rects only takes the tiles under the rects
+    black.setRect(40, 20, 300, 100, true);
+    red.setRect(500, 300, 120, 45, true);
+    const uint32_t expected = tilesOf(20, 100) + tilesOf(300, 45);
+    CHECK(pool.tilesInUse() == expected);
+
+    // Writing a tile's uniform value does not take a tile
+    black.setPixel(10, 400, false);
+    red.fillSpan(200, 0, 100, false);
+    CHECK(pool.tilesInUse() == expected);
+
+    // Full-width rects make tiles uniform again, compact() returns the rest
+    black.setRect(0, 16, WIDTH, 112, false);
+    CHECK(pool.tilesInUse() == tilesOf(300, 45));
+    red.setRect(500, 300, 120, 45, false);
+    CHECK(pool.tilesInUse() == tilesOf(300, 45));
+    red.compact();
+    CHECK(pool.tilesInUse() == 0);
+
+    black.setRect(0, 0, WIDTH, HEIGHT, true);
+    uint8_t fill;
+    CHECK(pool.tilesInUse() == 0 && black.isRowUniform(HEIGHT - 1, fill) && fill == 0xFF);
+    CHECK(pool.peakTilesInUse() == expected);
+}
+
+static void testMismatchedPool() {
+    // A pool of another width can't hold the rows, so the matrix falls back to dense storage
+    TilePool pool(BinaryMatrix::tileBytes(WIDTH / 2));
+    BinaryMatrix matrix(WIDTH, HEIGHT, &pool);
+    CHECK(!matrix.isSparse());
+    CHECK(matrix.buffer != nullptr);
+
+    matrix.setRect(0, 0, WIDTH, 64, true);
+    CHECK(matrix.getPixel(WIDTH - 1, 63));
+    CHECK(pool.tilesInUse() == 0);
+}
+
+static void testRandomWrites() {
+    TilePool pool(BinaryMatrix::tileBytes(WIDTH));
+    BinaryMatrix sparse(WIDTH, HEIGHT, &pool);
+    BinaryMatrix dense(WIDTH, HEIGHT);
+
+    srand(32);
+    for (int i = 0; i < 2000; i++) {
+        const int x = rand() % WIDTH;
+        const int y = rand() % HEIGHT;
+        const int w = 1 + rand() % (WIDTH - x);
+        const int h = 1 + rand() % min(HEIGHT - y, 40);
+        const bool value = rand() % 2;
+
+        switch (rand() % 6) {
+            case 0:
+                sparse.setPixel(x, y, value);
+                dense.setPixel(x, y, value);
+                break;
+            case 1:
+                sparse.setRect(x, y, w, h, value);
+                dense.setRect(x, y, w, h, value);
+                break;
+            case 2:
+                sparse.setRect(0, y, WIDTH, h, value);
+                dense.setRect(0, y, WIDTH, h, value);
+                break;
+            case 3: {
+                const uint8_t pattern = rand();
+                sparse.fillSpan(y, x, x + w, value, pattern);
+                dense.fillSpan(y, x, x + w, value, pattern);
+                break;
+            }
+            case 4: {
+                const int dx = rand() % 17 - 8;
+                const int dy = rand() % 17 - 8;
+                sparse.scroll(Rect(x, y, w, h), dx, dy, value);
+                dense.scroll(Rect(x, y, w, h), dx, dy, value);
+                break;
+            }
+            case 5:
+                sparse.compact();
+                break;
+        }
+    }
+    CHECK(samePixels(sparse, dense));
+
+    sparse.clear();
+    CHECK(pool.tilesInUse() == 0);
+}
+
+int main() {
+    testTileCounts();
+    testMismatchedPool();
+    testRandomWrites();
+    return testResult();
+}
@@ -0,0 +1,168 @@
+// Widgets: after random updates the planes are the same as drawing the final state fresh, and
+// each update leaves exactly the bounds of the widgets that visibly changed dirty.
+
+#include "box_font.h"
+#include "renderer.h"
+#include "widget.h"
+
+#include <string>
+#include <vector>
+
+#include "host_test.h"
+
+static const int WIDTH = 880;
+static const int HEIGHT = 528;
+
+static const char *TITLES[] = { "Greenhouse", "Greenhouse AV", "Cellar" };
+static const int FIELDS = 4;
+
+struct State {
+    int title = 0;
+    float values[FIELDS] = { 0, 0, 0, 0 };
+    float battery = 0;
+    float tank = 0;
+    int icon = 0;
+};
+
+// The dashboard of examples/Widgets, plus an icon and a second bar. Widgets keep gaps between
+// them, so their rects stay separate in the dirty region.
+struct Dashboard {
+    Container screen;
+    Label title;
+    std::vector<ValueField*> fields;
+    ProgressBar battery;
+    ProgressBar tank;
+    Icon icon;
+    const BinaryMatrix *const *icons;
+
+    Dashboard(Font *font, const BinaryMatrix *const *icons) :
+            screen(Rect(0, 0, WIDTH, HEIGHT), 2),
+            title(Rect(20, 20, 840, 24), font, "", TextAlignment::CENTER),
+            battery(Rect(20, 480, 840, 24), DisplayColor::RED, FillPattern::gray(40)),
+            tank(Rect(400, 300, 300, 20)),
+            icon(Rect(600, 100, 32, 32), icons[0], DisplayColor::RED),
+            icons(icons) {
+        screen.add(&title);
+        for (int i = 0; i < FIELDS; i++) {
+            fields.push_back(new ValueField(Rect(20, 80 + 40 * i, 300, 24), font, i % 3, i % 2 ? " %" : " C",
+                i % 2 ? TextAlignment::RIGHT : TextAlignment::LEFT));
+            screen.add(fields.back());
+        }
+        screen.add(&battery);
+        screen.add(&tank);
+        screen.add(&icon);
+    }
+
+    ~Dashboard() {
+        for (ValueField *field : fields) delete field;
+    }
+
+    void set(const State &state) {
+        title.setText(TITLES[state.title]);
+        for (int i = 0; i < FIELDS; i++) fields[i]->setValue(state.values[i]);
+        battery.setValue(state.battery);
+        tank.setValue(state.tank);
+        icon.setBitmap(icons[state.icon]);
+    }
+};
+
+static std::vector<uint8_t> planes(const Renderer &renderer) {
+    std::vector<uint8_t> buffer(2 * WIDTH / 8 * HEIGHT + 1024);
+    MemorySink sink(buffer.data(), buffer.size());
+    CHECK(renderer.saveSnapshot(sink));
+    buffer.resize(sink.size());
+    return buffer;
+}
+
+static bool sameRect(const Rect &a, const Rect &b) {
+    return a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height;
+}
+
+static int barPixels(const ProgressBar &bar, float value) {
+    return (int) (constrain(value, 0.0f, 1.0f) * (bar.getBounds().width - 2) + 0.5f);
+}
+
+int main() {
+    BoxFont box = makeBoxFont(12, 16);
+    Font font(*box.image, box.descriptor);
+
+    BinaryMatrix sun(32, 32);
+    BinaryMatrix cloud(32, 32);
+    sun.setRect(8, 8, 16, 16, true);
+    cloud.setRect(2, 12, 28, 12, true);
+    const BinaryMatrix *icons[] = { &sun, &cloud, nullptr };
+
+    Renderer renderer(WIDTH, HEIGHT);
+    Dashboard dashboard(&font, icons);
+    State state;
+    dashboard.set(state);
+    dashboard.screen.update(renderer);
+    renderer.render();
+
+    srand(37);
+    for (int round = 0; round < 100; round++) {
+        State next = state;
+        std::vector<Widget*> expected;
+
+        // Change a few widgets; some changes don't show, e.g. a value that formats the same
+        const int changes = 1 + rand() % 4;
+        for (int c = 0; c < changes; c++) {
+            const int which = rand() % (FIELDS + 4);
+            if (which < FIELDS) {
+                next.values[which] += (rand() % 200 - 100) / (rand() % 2 ? 10.0f : 1000.0f);
+            } else if (which == FIELDS) {
+                next.title = rand() % 3;
+            } else if (which == FIELDS + 1) {
+                next.battery = (rand() % 1000) / 999.0f;
+            } else if (which == FIELDS + 2) {
+                next.tank += (rand() % 21 - 10) / 1000.0f;
+            } else {
+                next.icon = rand() % 3;
+            }
+        }
+
+        for (int i = 0; i < FIELDS; i++) {
+            const std::string before = dashboard.fields[i]->getText();
+            dashboard.fields[i]->setValue(next.values[i]);
+            if (before != dashboard.fields[i]->getText()) expected.push_back(dashboard.fields[i]);
+        }
+        if (strcmp(TITLES[state.title], TITLES[next.title]) != 0) expected.push_back(&dashboard.title);
+        if (barPixels(dashboard.battery, state.battery) != barPixels(dashboard.battery, next.battery)) {
+            expected.push_back(&dashboard.battery);
+        }
+        if (barPixels(dashboard.tank, state.tank) != barPixels(dashboard.tank, next.tank)) {
+            expected.push_back(&dashboard.tank);
+        }
+        if (state.icon != next.icon) expected.push_back(&dashboard.icon);
+
+        dashboard.set(next);
+        state = next;
+        dashboard.screen.update(renderer);
+
+        // Exactly the changed widgets are dirty
+        const DirtyRegion &dirty = renderer.getDirtyRegion();
+        CHECK(dirty.count() == (int) expected.size());
+        for (Widget *widget : expected) {
+            bool found = false;
+            for (int i = 0; i < dirty.count(); i++) {
+                if (sameRect(dirty[i], widget->getBounds())) found = true;
+            }
+            CHECK(found);
+        }
+
+        if (round % 10 == 9) {
+            // The same state drawn on a fresh renderer
+            Renderer fresh(WIDTH, HEIGHT);
+            Dashboard freshDashboard(&font, icons);
+            freshDashboard.set(state);
+            freshDashboard.screen.update(fresh);
+            CHECK(planes(renderer) == planes(fresh));
+        }
+
+        renderer.render();
+        CHECK(!renderer.isDirty());
+    }
+
+    freeBoxFont(box);
+    return testResult();
+}
@@ -0,0 +1,159 @@
+// DrawQueue with std::thread producers and a Renderer draining it on the main thread, as the
+// render task of examples/DrawQueue does. Each producer draws in its own band of the screen, so
+// the final planes do not depend on how the commands interleave; they must equal the planes of a
+// renderer that made the same calls directly. Built against the library and the Arduino shim:
+//
+//   make -C ../host test
+
+#include "box_font.h"
+#include "draw_queue.h"
+#include "renderer.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "host_test.h"
+
+static const int WIDTH = 880;
+static const int HEIGHT = 528;
+static const int PRODUCERS = 4;
+static const int COMMANDS = 1500;
+static const int BAND = WIDTH / PRODUCERS;
+
+// Command i of a producer, with its own color, mode, pattern and clip. Uses its own generator,
+// as rand() is not thread safe.
+static DrawCommand makeCommand(int producer, int i, Font *font) {
+    uint32_t seed = producer * 7919 + i * 104729 + 1;
+    auto next = [&seed](int range) {
+        seed = seed * 1103515245 + 12345;
+        return (int) ((seed >> 8) % range);
+    };
+
+    const int x = producer * BAND + next(BAND);
+    const int y = next(HEIGHT);
+    DrawCommand command;
+    switch (next(8)) {
+        case 0: command = DrawCommand::drawRect(x, y, 1 + next(80), 1 + next(60)); break;
+        case 1: command = DrawCommand::fillRect(x, y, 1 + next(80), 1 + next(60)); break;
+        case 2: command = DrawCommand::fillRoundRect(x, y, 10 + next(60), 10 + next(40), next(5)); break;
+        case 3: command = DrawCommand::fillCircle(x, y, next(40)); break;
+        case 4: command = DrawCommand::drawLine(x, y, x + next(100) - 50, y + next(100) - 50); break;
+        case 5: command = DrawCommand::fillTriangle(x, y, x + next(60), y + next(30), x - next(60), y + next(50)); break;
+        case 6: {
+            char text[24];
+            snprintf(text, sizeof(text), "P%d %d.%d C", producer, i, next(10));
+            command = DrawCommand::drawText(x, y, text, font, (TextAlignment) next(3));
+            break;
+        }
+        default: command = DrawCommand::invalidate(Rect(x, y, 10, 10)); break;
+    }
+
+    command.color = next(4) == 0 ? DisplayColor::RED : DisplayColor::BLACK;
+    command.clear = next(5) == 0;
+    if (next(3) == 0) command.pattern = FillPattern::gray(next(65));
+
+    // Commands never reach past the producer's band
+    command.clip = Rect(producer * BAND, 0, BAND, HEIGHT);
+    if (next(4) == 0) command.clip = Rect(producer * BAND + 20, 40, BAND - 40, HEIGHT - 80);
+    return command;
+}
+
+// What Renderer::execute() should do, through the public calls
+static void drawDirectly(Renderer &renderer, const DrawCommand &c) {
+    const int16_t *a = c.args;
+    renderer.setColor(c.color);
+    if (c.clear) renderer.setClearMode(); else renderer.setDrawMode();
+    renderer.setFont(c.font);
+    renderer.setClipRect(c.clip);
+    renderer.setFillPattern(c.pattern);
+
+    switch (c.op) {
+        case DRAW_RECT: renderer.drawRect(a[0], a[1], a[2], a[3]); break;
+        case DRAW_FILL_RECT: renderer.fillRect(a[0], a[1], a[2], a[3]); break;
+        case DRAW_ROUND_RECT: renderer.fillRoundRect(a[0], a[1], a[2], a[3], a[4]); break;
+        case DRAW_CIRCLE: renderer.fillCircle(a[0], a[1], a[2]); break;
+        case DRAW_LINE: renderer.drawLine(a[0], a[1], a[2], a[3]); break;
+        case DRAW_TRIANGLE: renderer.fillTriangle(a[0], a[1], a[2], a[3], a[4], a[5]); break;
+        case DRAW_TEXT: renderer.drawText(a[0], a[1], c.text, c.align); break;
+        case DRAW_INVALIDATE: renderer.invalidate(Rect(a[0], a[1], a[2], a[3])); break;
+    }
+}
+
+static std::vector<uint8_t> planes(const Renderer &renderer) {
+    std::vector<uint8_t> buffer(2 * WIDTH / 8 * HEIGHT + 1024);
+    MemorySink sink(buffer.data(), buffer.size());
+    CHECK(renderer.saveSnapshot(sink));
+    buffer.resize(sink.size());
+    return buffer;
+}
+
+int main() {
+    BoxFont box = makeBoxFont(12, 16);
+    Font font(*box.image, box.descriptor);
+    Font otherFont(*box.image, box.descriptor);
+
+    Renderer renderer(WIDTH, HEIGHT);
+    renderer.getDisplay().transport().setRefreshMs(5);
+    renderer.setFont(&otherFont);
+    const Rect ownClip(100, 100, 50, 50);
+    renderer.setClipRect(ownClip);
+
+    // Small, so producers find it full and retry
+    DrawQueue queue(64);
+    std::atomic<int> running(PRODUCERS);
+    std::atomic<long> fullRetries(0);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < PRODUCERS; p++) {
+        threads.emplace_back([&, p]() {
+            for (int i = 0; i < COMMANDS; i++) {
+                const DrawCommand command = makeCommand(p, i, &font);
+                while (!queue.push(command)) {
+                    fullRetries++;
+                    std::this_thread::yield();
+                }
+            }
+            running--;
+        });
+    }
+
+    // The render task: drain in batches, refresh whenever the panel is idle
+    long executed = 0;
+    int refreshes = 0;
+    while (true) {
+        const bool done = running.load() == 0;
+        const int n = renderer.drain(queue, 16);
+        executed += n;
+        if (n == 0 && done) break;
+
+        if (renderer.isDirty() && !renderer.isBusy()) {
+            renderer.renderAsync();
+            refreshes++;
+        }
+        if (n == 0) std::this_thread::yield();
+    }
+    for (std::thread &t : threads) t.join();
+    renderer.waitIdle();
+
+    CHECK(executed == (long) PRODUCERS * COMMANDS);
+    CHECK(queue.rejected() == (uint32_t) fullRetries.load());
+    CHECK(refreshes > 0);
+
+    // drain() restores the renderer's own settings
+    CHECK(renderer.getFont() == &otherFont);
+    const Rect clip = renderer.getClipRect();
+    CHECK(clip.x == ownClip.x && clip.y == ownClip.y && clip.width == ownClip.width && clip.height == ownClip.height);
+
+    Renderer reference(WIDTH, HEIGHT);
+    for (int p = 0; p < PRODUCERS; p++) {
+        for (int i = 0; i < COMMANDS; i++) {
+            drawDirectly(reference, makeCommand(p, i, &font));
+        }
+    }
+    CHECK(planes(renderer) == planes(reference));
+
+    printf("%ld commands, %d refreshes, %ld pushes retried\n", executed, refreshes, fullRetries.load());
+    freeBoxFont(box);
+    return testResult();
+}
@@ -0,0 +1,107 @@
+// Stress test and throughput numbers for MpscQueue (mpsc_queue.h) on the host, with std::thread
+// producers and one consumer.
+//
+//   g++ -std=c++11 -O2 -pthread -I../.. -o queue_bench queue_bench.cpp
+//   ./queue_bench [items per producer]
+//
+// Every run checks that each item arrives exactly once and that the items of each producer
+// arrive in the order they were pushed.
+
+#include "mpsc_queue.h"
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+
+// About the size of a DrawCommand
+struct Item {
+    uint32_t producer;
+    uint32_t sequence;
+    uint8_t payload[88];
+};
+
+struct Result {
+    double seconds;
+    uint64_t fullRetries;
+    bool ok;
+};
+
+static Result run(int producers, uint32_t itemsPerProducer, uint32_t capacity) {
+    MpscQueue<Item> queue(capacity);
+    std::vector<uint32_t> expected(producers, 0);
+    std::vector<std::thread> threads;
+    bool ok = true;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&queue, p, itemsPerProducer]() {
+            Item item;
+            item.producer = p;
+            for (uint32_t i = 0; i < itemsPerProducer; i++) {
+                item.sequence = i;
+                item.payload[0] = (uint8_t) i;
+                item.payload[sizeof(item.payload) - 1] = (uint8_t) ~i;
+                while (!queue.push(item)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    const uint64_t total = (uint64_t) producers * itemsPerProducer;
+    Item item;
+    for (uint64_t received = 0; received < total; ) {
+        if (!queue.pop(item)) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        if (item.producer >= (uint32_t) producers || item.sequence != expected[item.producer]
+                || item.payload[0] != (uint8_t) item.sequence
+                || item.payload[sizeof(item.payload) - 1] != (uint8_t) ~item.sequence) {
+            fprintf(stderr, "FAIL: producer %u item %u, expected item %u\n", item.producer, item.sequence,
+                item.producer < (uint32_t) producers ? expected[item.producer] : 0);
+            ok = false;
+        } else {
+            expected[item.producer]++;
+        }
+        received++;
+    }
+
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    const auto end = std::chrono::steady_clock::now();
+    ok = ok && !queue.pop(item);
+
+    Result result;
+    result.seconds = std::chrono::duration<double>(end - start).count();
+    result.fullRetries = queue.rejected();
+    result.ok = ok;
+    return result;
+}
+
+int main(int argc, char **argv) {
+    const uint32_t items = argc > 1 ? atoi(argv[1]) : 1000000;
+    bool ok = true;
+
+    printf("%u items per producer, %zu byte items, %u hardware threads\n", items, sizeof(Item),
+        std::thread::hardware_concurrency());
+    printf("producers  capacity  Mitems/s  ns/item  full retries  result\n");
+
+    for (uint32_t capacity : { 64u, 1024u }) {
+        for (int producers : { 1, 2, 4, 8 }) {
+            const Result r = run(producers, items, capacity);
+            const double total = (double) producers * items;
+            printf("%9d  %8u  %8.2f  %7.1f  %12llu  %s\n", producers, capacity, total / r.seconds / 1e6,
+                r.seconds * 1e9 / total, (unsigned long long) r.fullRetries, r.ok ? "ok" : "FAIL");
+            ok = ok && r.ok;
+        }
+    }
+
+    return ok ? 0 : 1;
+}
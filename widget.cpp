@@ -0,0 +1,168 @@
+#include "widget.h"
+
+Widget::Widget(Rect bounds) : _bounds(bounds) {}
+
+Widget::~Widget() {}
+
+Rect Widget::getBounds() const {
+    return _bounds;
+}
+
+bool Widget::isDirty() const {
+    return _dirty;
+}
+
+void Widget::invalidate() {
+    _dirty = true;
+}
+
+void Widget::update(Renderer &renderer) {
+    if (_dirty) redraw(renderer);
+}
+
+void Widget::redraw(Renderer &renderer) {
+    const Rect previousClip = renderer.getClipRect();
+    renderer.setClipRect(_bounds.intersect(previousClip));
+
+    // Clear the bounds in both planes
+    renderer.setFillPattern(FillPattern());
+    renderer.setClearMode();
+    renderer.setColor(DisplayColor::BLACK);
+    renderer.fillRect(_bounds.x, _bounds.y, _bounds.width, _bounds.height);
+    renderer.setColor(DisplayColor::RED);
+    renderer.fillRect(_bounds.x, _bounds.y, _bounds.width, _bounds.height);
+    renderer.setDrawMode();
+
+    draw(renderer);
+
+    renderer.setClipRect(previousClip);
+    _dirty = false;
+}
+
+
+Label::Label(Rect bounds, Font *font, const char *text, TextAlignment align, DisplayColor color) :
+    Widget(bounds), _text(text), _font(font), _align(align), _color(color) {}
+
+void Label::setText(const char *text) {
+    if (_text == text) return;
+
+    _text = text;
+    invalidate();
+}
+
+const char *Label::getText() const {
+    return _text.c_str();
+}
+
+void Label::draw(Renderer &renderer) {
+    int x = _bounds.x;
+    switch (_align) {
+        case TextAlignment::LEFT:
+            break;
+        case TextAlignment::CENTER:
+            x = _bounds.x + _bounds.width / 2;
+            break;
+        case TextAlignment::RIGHT:
+            x = _bounds.x + _bounds.width;
+            break;
+    }
+
+    renderer.setFont(_font);
+    renderer.setColor(_color);
+    renderer.drawText(x, _bounds.y, _text.c_str(), _align);
+}
+
+
+ValueField::ValueField(Rect bounds, Font *font, uint8_t decimals, const char *unit, TextAlignment align, DisplayColor color) :
+    Label(bounds, font, "", align, color), _decimals(decimals), _unit(unit) {}
+
+void ValueField::setValue(float value) {
+    char text[32];
+    snprintf(text, sizeof(text), "%.*f%s", _decimals, value, _unit);
+    setText(text);
+}
+
+
+ProgressBar::ProgressBar(Rect bounds, DisplayColor color, const FillPattern &pattern) :
+    Widget(bounds), _color(color), _pattern(pattern) {}
+
+void ProgressBar::setValue(float value) {
+    _value = constrain(value, 0.0f, 1.0f);
+
+    // Inside of the 1 pixel border
+    const int filled = (int) (_value * (_bounds.width - 2) + 0.5f);
+    if (filled == _filled) return;
+
+    _filled = filled;
+    invalidate();
+}
+
+float ProgressBar::getValue() const {
+    return _value;
+}
+
+void ProgressBar::draw(Renderer &renderer) {
+    renderer.setColor(DisplayColor::BLACK);
+    renderer.drawRect(_bounds.x, _bounds.y, _bounds.width, _bounds.height);
+
+    renderer.setColor(_color);
+    renderer.setFillPattern(_pattern);
+    renderer.fillRect(_bounds.x + 1, _bounds.y + 1, _filled, _bounds.height - 2);
+    renderer.setFillPattern(FillPattern());
+}
+
+
+Icon::Icon(Rect bounds, const BinaryMatrix *bitmap, DisplayColor color) :
+    Widget(bounds), _bitmap(bitmap), _color(color) {}
+
+void Icon::setBitmap(const BinaryMatrix *bitmap) {
+    if (_bitmap == bitmap) return;
+
+    _bitmap = bitmap;
+    invalidate();
+}
+
+void Icon::draw(Renderer &renderer) {
+    if (_bitmap == nullptr) return;
+
+    renderer.setColor(_color);
+    renderer.blit(*_bitmap, Rect(0, 0, _bitmap->width, _bitmap->height), _bounds.x, _bounds.y, ROP_OR);
+}
+
+
+Container::Container(Rect bounds, int border) : Widget(bounds), _border(border) {}
+
+void Container::add(Widget *child) {
+    _children.push_back(child);
+    invalidate();
+}
+
+void Container::invalidate() {
+    Widget::invalidate();
+    for (Widget *child : _children) {
+        child->invalidate();
+    }
+}
+
+void Container::update(Renderer &renderer) {
+    // Clearing the bounds of the container wipes the children, which are invalidated with it
+    if (_dirty) redraw(renderer);
+
+    const Rect previousClip = renderer.getClipRect();
+    renderer.setClipRect(_bounds.intersect(previousClip));
+
+    for (Widget *child : _children) {
+        child->update(renderer);
+    }
+
+    renderer.setClipRect(previousClip);
+}
+
+void Container::draw(Renderer &renderer) {
+    if (_border <= 0) return;
+
+    renderer.setColor(DisplayColor::BLACK);
+    for (int i = 0; i < _border; i++) {
+        renderer.drawRect(_bounds.x + i, _bounds.y + i, _bounds.width - 2 * i, _bounds.height - 2 * i);
+    }
+}
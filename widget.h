@@ -0,0 +1,127 @@
+#ifndef widget_h
+#define widget_h
+
+#include <Arduino.h>
+#include <vector>
+
+#include "renderer.h"
+
+/**
+ * Retained UI element with fixed bounds. Changing what a widget shows invalidates it, and
+ * update() redraws only invalidated widgets: the renderer is clipped to the widget's bounds, the
+ * bounds are cleared in both planes and draw() is called. The renderer then sends exactly those
+ * rects on render() when partial transfer is enabled.
+ *
+ * update() changes the renderer's clip, color, draw mode and fill pattern.
+ */
+class Widget {
+protected:
+    const Rect _bounds;
+    bool _dirty = true;
+
+public:
+    Widget(Rect bounds);
+    virtual ~Widget();
+
+    Rect getBounds() const;
+
+    bool isDirty() const;
+    virtual void invalidate();
+
+    // Redraws the widget if it is dirty
+    virtual void update(Renderer &renderer);
+
+protected:
+    // Draws the widget on cleared bounds, with the renderer clipped to them
+    virtual void draw(Renderer &renderer) = 0;
+
+    void redraw(Renderer &renderer);
+};
+
+class Label : public Widget {
+protected:
+    String _text;
+    Font *_font;
+    TextAlignment _align;
+    DisplayColor _color;
+
+public:
+    Label(Rect bounds, Font *font, const char *text = "", TextAlignment align = TextAlignment::LEFT,
+        DisplayColor color = DisplayColor::BLACK);
+
+    // Only invalidates if the text differs
+    void setText(const char *text);
+    const char *getText() const;
+
+protected:
+    void draw(Renderer &renderer) override;
+};
+
+/**
+ * Label showing a number with a fixed number of decimals and a unit, e.g. "21.5 C". Setting a
+ * value that formats the same does not invalidate the field.
+ */
+class ValueField : public Label {
+    uint8_t _decimals;
+    const char *_unit;
+
+public:
+    ValueField(Rect bounds, Font *font, uint8_t decimals = 0, const char *unit = "",
+        TextAlignment align = TextAlignment::RIGHT, DisplayColor color = DisplayColor::BLACK);
+
+    void setValue(float value);
+};
+
+class ProgressBar : public Widget {
+    float _value = 0;
+    int _filled = 0; // width of the bar in pixels
+    DisplayColor _color;
+    FillPattern _pattern;
+
+public:
+    ProgressBar(Rect bounds, DisplayColor color = DisplayColor::BLACK, const FillPattern &pattern = FillPattern());
+
+    // 0 to 1. Only invalidates if the bar changes by at least a pixel.
+    void setValue(float value);
+    float getValue() const;
+
+protected:
+    void draw(Renderer &renderer) override;
+};
+
+// 1-bit bitmap, set pixels are drawn in the color
+class Icon : public Widget {
+    const BinaryMatrix *_bitmap;
+    DisplayColor _color;
+
+public:
+    Icon(Rect bounds, const BinaryMatrix *bitmap, DisplayColor color = DisplayColor::BLACK);
+
+    void setBitmap(const BinaryMatrix *bitmap);
+
+protected:
+    void draw(Renderer &renderer) override;
+};
+
+/**
+ * Groups widgets, which must lie within its bounds. Updating a container updates its dirty
+ * children; invalidating it redraws its border and every child.
+ */
+class Container : public Widget {
+    std::vector<Widget*> _children;
+    int _border;
+
+public:
+    Container(Rect bounds, int border = 0);
+
+    // Children are not owned
+    void add(Widget *child);
+
+    void invalidate() override;
+    void update(Renderer &renderer) override;
+
+protected:
+    void draw(Renderer &renderer) override;
+};
+
+#endif